@@ -0,0 +1,82 @@
+//
+//  QueuedObserver.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef QueuedObserver_hpp
+#define QueuedObserver_hpp
+
+#include "Observer.hpp"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Activity {
+
+/*!
+	Stands between a source of activity that may run on any thread and an observer that expects
+	to be called only from its machine's thread: activity reported to this observer is queued, and is
+	forwarded to the actual observer, in order, only upon a call to @c deliver.
+*/
+class QueuedObserver: public Observer {
+	public:
+		/// Sets the observer to which queued activity will be delivered, discarding anything already queued.
+		void set_observer(Observer *observer) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			observer_ = observer;
+			events_.clear();
+		}
+
+		/// Forwards all activity queued since the last call to the current observer.
+		void deliver() {
+			std::vector<std::function<void(Observer *)>> events;
+			Observer *observer;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if(events_.empty()) return;
+				events.swap(events_);
+				observer = observer_;
+			}
+			if(!observer) return;
+			for(const auto &event: events) event(observer);
+		}
+
+		void register_led(const std::string &name) override {
+			enqueue([name] (Observer *observer) { observer->register_led(name); });
+		}
+
+		void register_drive(const std::string &name) override {
+			enqueue([name] (Observer *observer) { observer->register_drive(name); });
+		}
+
+		void set_led_status(const std::string &name, bool lit) override {
+			enqueue([name, lit] (Observer *observer) { observer->set_led_status(name, lit); });
+		}
+
+		void announce_drive_event(const std::string &name, DriveEvent event) override {
+			enqueue([name, event] (Observer *observer) { observer->announce_drive_event(name, event); });
+		}
+
+		void set_drive_motor_status(const std::string &name, bool is_on) override {
+			enqueue([name, is_on] (Observer *observer) { observer->set_drive_motor_status(name, is_on); });
+		}
+
+	private:
+		std::mutex mutex_;
+		Observer *observer_ = nullptr;
+		std::vector<std::function<void(Observer *)>> events_;
+
+		void enqueue(std::function<void(Observer *)> &&event) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			if(observer_) events_.push_back(std::move(event));
+		}
+};
+
+}
+
+#endif /* QueuedObserver_hpp */
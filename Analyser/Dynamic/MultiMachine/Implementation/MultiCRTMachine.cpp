@@ -8,41 +8,23 @@
 
 #include "MultiCRTMachine.hpp"
 
-#include <condition_variable>
+#include "../../../../Concurrency/ThreadPool.hpp"
+
 #include <mutex>
 
 using namespace Analyser::Dynamic;
 
 MultiCRTMachine::MultiCRTMachine(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::mutex &machines_mutex) :
-	machines_(machines), machines_mutex_(machines_mutex), queues_(machines.size()) {
+	machines_(machines), machines_mutex_(machines_mutex) {
 	speaker_ = MultiSpeaker::create(machines);
 }
 
 void MultiCRTMachine::perform_parallel(const std::function<void(::CRTMachine::Machine *)> &function) {
-	// Apply a blunt force parallelisation of the machines; each run_for is dispatched
-	// to a separate queue and this queue will block until all are done.
-	volatile std::size_t outstanding_machines;
-	std::condition_variable condition;
-	std::mutex mutex;
-	{
-		std::lock_guard<std::mutex> machines_lock(machines_mutex_);
-		std::lock_guard<std::mutex> lock(mutex);
-		outstanding_machines = machines_.size();
-
-		for(std::size_t index = 0; index < machines_.size(); ++index) {
-			CRTMachine::Machine *crt_machine = machines_[index]->crt_machine();
-			queues_[index].enqueue([&mutex, &condition, crt_machine, function, &outstanding_machines]() {
-				if(crt_machine) function(crt_machine);
-
-				std::lock_guard<std::mutex> lock(mutex);
-				outstanding_machines--;
-				condition.notify_all();
-			});
-		}
-	}
-
-	std::unique_lock<std::mutex> lock(mutex);
-	condition.wait(lock, [&outstanding_machines] { return !outstanding_machines; });
+	std::lock_guard<std::mutex> machines_lock(machines_mutex_);
+	Concurrency::ThreadPool::shared().parallel_for(machines_.size(), [this, &function] (std::size_t index) {
+		CRTMachine::Machine *crt_machine = machines_[index]->crt_machine();
+		if(crt_machine) function(crt_machine);
+	});
 }
 
 void MultiCRTMachine::perform_serial(const std::function<void (::CRTMachine::Machine *)> &function) {
@@ -59,6 +41,12 @@ void MultiCRTMachine::setup_output(float aspect_ratio) {
 	});
 }
 
+void MultiCRTMachine::set_output_backend(Outputs::CRT::OutputBackend backend) {
+	perform_serial([=](::CRTMachine::Machine *machine) {
+		machine->set_output_backend(backend);
+	});
+}
+
 void MultiCRTMachine::close_output() {
 	perform_serial([=](::CRTMachine::Machine *machine) {
 		machine->close_output();
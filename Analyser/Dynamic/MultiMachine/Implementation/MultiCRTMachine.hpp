@@ -9,12 +9,12 @@
 #ifndef MultiCRTMachine_hpp
 #define MultiCRTMachine_hpp
 
-#include "../../../../Concurrency/AsyncTaskQueue.hpp"
 #include "../../../../Machines/CRTMachine.hpp"
 #include "../../../../Machines/DynamicMachine.hpp"
 
 #include "MultiSpeaker.hpp"
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -54,6 +54,7 @@ class MultiCRTMachine: public CRTMachine::Machine {
 
 		// Below is the standard CRTMachine::Machine interface; see there for documentation.
 		void setup_output(float aspect_ratio) override;
+		void set_output_backend(Outputs::CRT::OutputBackend backend) override;
 		void close_output() override;
 		Outputs::CRT::CRT *get_crt() override;
 		Outputs::Speaker::Speaker *get_speaker() override;
@@ -63,13 +64,13 @@ class MultiCRTMachine: public CRTMachine::Machine {
 		void run_for(const Cycles cycles) override {}
 		const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines_;
 		std::mutex &machines_mutex_;
-		std::vector<Concurrency::AsyncTaskQueue> queues_;
 		MultiSpeaker *speaker_ = nullptr;
 		Delegate *delegate_ = nullptr;
 
 		/*!
 			Performs a parallel for operation across all machines, performing the supplied
-			function on each and returning only once all applications have completed.
+			function on each via the shared thread pool and returning only once all applications
+			have completed.
 
 			No guarantees are extended as to which thread operations will occur on.
 		*/
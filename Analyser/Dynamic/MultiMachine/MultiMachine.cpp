@@ -66,6 +66,22 @@ Configurable::Device *MultiMachine::configurable_device() {
 	}
 }
 
+SnapshotMachine::Machine *MultiMachine::snapshot_machine() {
+	if(has_picked_) {
+		return machines_.front()->snapshot_machine();
+	} else {
+		return nullptr;
+	}
+}
+
+::Machine::DynamicMachine *MultiMachine::fork() {
+	if(has_picked_) {
+		return machines_.front()->fork();
+	} else {
+		return nullptr;
+	}
+}
+
 bool MultiMachine::would_collapse(const std::vector<std::unique_ptr<DynamicMachine>> &machines) {
 	return
 		(machines.front()->crt_machine()->get_confidence() > 0.9f) ||
@@ -56,6 +56,12 @@ class MultiMachine: public ::Machine::DynamicMachine, public MultiCRTMachine::De
 		JoystickMachine::Machine *joystick_machine() override;
 		KeyboardMachine::Machine *keyboard_machine() override;
 		Configurable::Device *configurable_device() override;
+
+		/// @returns @c nullptr until a single machine has been picked, as a snapshot of several candidate machines is not supported.
+		SnapshotMachine::Machine *snapshot_machine() override;
+
+		/// @returns @c nullptr until a single machine has been picked; thereafter a fork of that machine.
+		DynamicMachine *fork() override;
 		void *raw_pointer() override;
 
 	private:
@@ -179,6 +179,28 @@ static bool CheckBootSector(const std::shared_ptr<Storage::Disk::Disk> &disk, co
 	return false;
 }
 
+Storage::Disk::CPM::ParameterBlock Analyser::Static::AmstradCPC::DataFormat() {
+	Storage::Disk::CPM::ParameterBlock data_format;
+	data_format.sectors_per_track = 9;
+	data_format.tracks = 40;
+	data_format.block_size = 1024;
+	data_format.first_sector = 0xc1;
+	data_format.catalogue_allocation_bitmap = 0xc000;
+	data_format.reserved_tracks = 0;
+	return data_format;
+}
+
+Storage::Disk::CPM::ParameterBlock Analyser::Static::AmstradCPC::SystemFormat() {
+	Storage::Disk::CPM::ParameterBlock system_format;
+	system_format.sectors_per_track = 9;
+	system_format.tracks = 40;
+	system_format.block_size = 1024;
+	system_format.first_sector = 0x41;
+	system_format.catalogue_allocation_bitmap = 0xc000;
+	system_format.reserved_tracks = 2;
+	return system_format;
+}
+
 Analyser::Static::TargetList Analyser::Static::AmstradCPC::GetTargets(const Media &media, const std::string &file_name, TargetPlatform::IntType potential_platforms) {
 	TargetList destination;
 	std::unique_ptr<Target> target(new Target);
@@ -198,21 +220,8 @@ Analyser::Static::TargetList Analyser::Static::AmstradCPC::GetTargets(const Medi
 	}
 
 	if(!media.disks.empty()) {
-		Storage::Disk::CPM::ParameterBlock data_format;
-		data_format.sectors_per_track = 9;
-		data_format.tracks = 40;
-		data_format.block_size = 1024;
-		data_format.first_sector = 0xc1;
-		data_format.catalogue_allocation_bitmap = 0xc000;
-		data_format.reserved_tracks = 0;
-
-		Storage::Disk::CPM::ParameterBlock system_format;
-		system_format.sectors_per_track = 9;
-		system_format.tracks = 40;
-		system_format.block_size = 1024;
-		system_format.first_sector = 0x41;
-		system_format.catalogue_allocation_bitmap = 0xc000;
-		system_format.reserved_tracks = 2;
+		const Storage::Disk::CPM::ParameterBlock data_format = DataFormat();
+		const Storage::Disk::CPM::ParameterBlock system_format = SystemFormat();
 
 		for(auto &disk: media.disks) {
 			// Check for an ordinary catalogue.
@@ -11,6 +11,7 @@
 
 #include "../StaticAnalyser.hpp"
 #include "../../../Storage/TargetPlatforms.hpp"
+#include "../../../Storage/Disk/Parsers/CPM.hpp"
 #include <string>
 
 namespace Analyser {
@@ -19,6 +20,12 @@ namespace AmstradCPC {
 
 TargetList GetTargets(const Media &media, const std::string &file_name, TargetPlatform::IntType potential_platforms);
 
+/// @returns The CP/M parameters of the CPC's data format.
+Storage::Disk::CPM::ParameterBlock DataFormat();
+
+/// @returns The CP/M parameters of the CPC's system format, which reserves two tracks for booting.
+Storage::Disk::CPM::ParameterBlock SystemFormat();
+
 }
 }
 }
@@ -0,0 +1,413 @@
+//
+//  AnalysisCache.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "AnalysisCache.hpp"
+
+#include "Acorn/Target.hpp"
+#include "AmstradCPC/Target.hpp"
+#include "AppleII/Target.hpp"
+#include "Atari/Target.hpp"
+#include "Commodore/Target.hpp"
+#include "MSX/Cartridge.hpp"
+#include "MSX/Target.hpp"
+#include "Oric/Target.hpp"
+#include "ZX8081/Target.hpp"
+
+#include "../../Storage/FileHolder.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+#include <unistd.h>
+
+using namespace Analyser::Static;
+
+const uint32_t AnalysisCache::AnalyserVersion = 1;
+
+namespace {
+
+const char Signature[] = "CLKAnalysisCache";
+
+/// Identifies the type of a stored cartridge.
+enum class CartridgeType: uint8_t {
+	Generic,
+	MSX
+};
+
+/// Accumulates the serialised form of a cache entry.
+class Writer {
+	public:
+		template <typename IntT> void integer(IntT value) {
+			const uint64_t wide_value = static_cast<uint64_t>(value);
+			for(std::size_t c = 0; c < sizeof(IntT); ++c) {
+				data.push_back(static_cast<uint8_t>(wide_value >> (c * 8)));
+			}
+		}
+
+		void bytes(const std::vector<uint8_t> &value) {
+			integer(static_cast<uint32_t>(value.size()));
+			data.insert(data.end(), value.begin(), value.end());
+		}
+
+		void operator()(bool &value)			{	integer(static_cast<uint8_t>(value ? 1 : 0));	}
+		void operator()(float &value) {
+			uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			integer(bits);
+		}
+		void operator()(std::string &value) {
+			integer(static_cast<uint32_t>(value.size()));
+			data.insert(data.end(), value.begin(), value.end());
+		}
+		template <typename EnumT> void operator()(EnumT &value) {
+			static_assert(std::is_enum<EnumT>::value, "Only enums, bools, floats and strings can be serialised");
+			integer(static_cast<uint8_t>(value));
+		}
+
+		std::vector<uint8_t> data;
+};
+
+/// Reads back the serialised form of a cache entry, noting any attempt to read beyond its end.
+class Reader {
+	public:
+		Reader(const Storage::FileHolder::Span &span) : span_(span) {}
+
+		template <typename IntT> IntT integer() {
+			if(span_.size - offset_ < sizeof(IntT)) {
+				overran = true;
+				return 0;
+			}
+			uint64_t value = 0;
+			for(std::size_t c = 0; c < sizeof(IntT); ++c) {
+				value |= static_cast<uint64_t>(span_.data[offset_ + c]) << (c * 8);
+			}
+			offset_ += sizeof(IntT);
+			return static_cast<IntT>(value);
+		}
+
+		std::vector<uint8_t> bytes() {
+			const uint32_t size = integer<uint32_t>();
+			if(span_.size - offset_ < size) {
+				overran = true;
+				return std::vector<uint8_t>();
+			}
+			std::vector<uint8_t> result(&span_.data[offset_], &span_.data[offset_ + size]);
+			offset_ += size;
+			return result;
+		}
+
+		bool check_signature() {
+			if(span_.size < sizeof(Signature) || std::memcmp(span_.data, Signature, sizeof(Signature))) return false;
+			offset_ = sizeof(Signature);
+			return true;
+		}
+
+		void operator()(bool &value)			{	value = !!integer<uint8_t>();	}
+		void operator()(float &value) {
+			const uint32_t bits = integer<uint32_t>();
+			std::memcpy(&value, &bits, sizeof(bits));
+		}
+		void operator()(std::string &value) {
+			const std::vector<uint8_t> data = bytes();
+			value.assign(data.begin(), data.end());
+		}
+		template <typename EnumT> void operator()(EnumT &value) {
+			static_assert(std::is_enum<EnumT>::value, "Only enums, bools, floats and strings can be serialised");
+			value = static_cast<EnumT>(integer<uint8_t>());
+		}
+
+		bool overran = false;
+
+	private:
+		const Storage::FileHolder::Span span_;
+		std::size_t offset_ = 0;
+};
+
+// Each of the following visits the fields particular to a platform's target with @c archive,
+// which is either a Reader or a Writer.
+
+template <typename Archive> void Fields(Archive &archive, Acorn::Target &target) {
+	archive(target.has_adfs);
+	archive(target.has_dfs);
+	archive(target.should_shift_restart);
+	archive(target.loading_command);
+}
+
+template <typename Archive> void Fields(Archive &archive, AmstradCPC::Target &target) {
+	archive(target.model);
+	archive(target.loading_command);
+}
+
+template <typename Archive> void Fields(Archive &archive, AppleII::Target &target) {
+	archive(target.model);
+	archive(target.disk_controller);
+}
+
+template <typename Archive> void Fields(Archive &archive, Atari::Target &target) {
+	archive(target.paging_model);
+	archive(target.uses_superchip);
+}
+
+template <typename Archive> void Fields(Archive &archive, Commodore::Target &target) {
+	archive(target.memory_model);
+	archive(target.region);
+	archive(target.has_c1540);
+	archive(target.loading_command);
+}
+
+template <typename Archive> void Fields(Archive &archive, MSX::Target &target) {
+	archive(target.has_disk_drive);
+	archive(target.loading_command);
+}
+
+template <typename Archive> void Fields(Archive &archive, Oric::Target &target) {
+	archive(target.rom);
+	archive(target.disk_interface);
+	archive(target.loading_command);
+}
+
+template <typename Archive> void Fields(Archive &archive, ZX8081::Target &target) {
+	archive(target.memory_model);
+	archive(target.is_ZX81);
+	archive(target.ZX80_uses_ZX81_ROM);
+	archive(target.loading_command);
+}
+
+template <typename Archive, typename TargetT> bool SpecificFields(Archive &archive, Target &target) {
+	TargetT *const specific_target = dynamic_cast<TargetT *>(&target);
+	if(!specific_target) return false;
+	Fields(archive, *specific_target);
+	return true;
+}
+
+/*!
+	Visits the fields particular to the platform of @c target with @c archive.
+
+	@returns @c true if @c target is of the type expected for its machine; @c false otherwise.
+*/
+template <typename Archive> bool PlatformFields(Archive &archive, Target &target) {
+	switch(target.machine) {
+		default:								return false;
+		case Analyser::Machine::AmstradCPC:		return SpecificFields<Archive, AmstradCPC::Target>(archive, target);
+		case Analyser::Machine::AppleII:		return SpecificFields<Archive, AppleII::Target>(archive, target);
+		case Analyser::Machine::Atari2600:		return SpecificFields<Archive, Atari::Target>(archive, target);
+		case Analyser::Machine::ColecoVision:	return true;
+		case Analyser::Machine::Electron:		return SpecificFields<Archive, Acorn::Target>(archive, target);
+		case Analyser::Machine::MSX:			return SpecificFields<Archive, MSX::Target>(archive, target);
+		case Analyser::Machine::Oric:			return SpecificFields<Archive, Oric::Target>(archive, target);
+		case Analyser::Machine::Vic20:			return SpecificFields<Archive, Commodore::Target>(archive, target);
+		case Analyser::Machine::ZX8081:			return SpecificFields<Archive, ZX8081::Target>(archive, target);
+	}
+}
+
+/// @returns A new target of the type appropriate to @c machine, or @c nullptr if @c machine is unrecognised.
+Target *NewTarget(Analyser::Machine machine) {
+	switch(machine) {
+		default:								return nullptr;
+		case Analyser::Machine::AmstradCPC:		return new AmstradCPC::Target;
+		case Analyser::Machine::AppleII:		return new AppleII::Target;
+		case Analyser::Machine::Atari2600:		return new Atari::Target;
+		case Analyser::Machine::ColecoVision:	return new Target;
+		case Analyser::Machine::Electron:		return new Acorn::Target;
+		case Analyser::Machine::MSX:			return new MSX::Target;
+		case Analyser::Machine::Oric:			return new Oric::Target;
+		case Analyser::Machine::Vic20:			return new Commodore::Target;
+		case Analyser::Machine::ZX8081:			return new ZX8081::Target;
+	}
+}
+
+void WriteStrings(Writer &writer, const std::vector<std::string> &strings) {
+	writer.integer(static_cast<uint32_t>(strings.size()));
+	for(auto string: strings) writer(string);
+}
+
+std::vector<std::string> ReadStrings(Reader &reader) {
+	std::vector<std::string> strings;
+	uint32_t count = reader.integer<uint32_t>();
+	while(count-- && !reader.overran) {
+		strings.emplace_back();
+		reader(strings.back());
+	}
+	return strings;
+}
+
+/// @returns The final component of @c path.
+std::string LeafName(const std::string &path) {
+	const auto final_slash = path.find_last_of("/\\");
+	return (final_slash == std::string::npos) ? path : path.substr(final_slash + 1);
+}
+
+}
+
+AnalysisCache::AnalysisCache(const std::string &directory) : directory_(directory) {}
+
+bool AnalysisCache::get_key(const std::string &file_name, Key &key) {
+	try {
+		Storage::FileHolder file(file_name, Storage::FileHolder::FileMode::MappedRead);
+		key.size = static_cast<uint64_t>(file.stats().st_size);
+		const Storage::FileHolder::Span contents = file.view(0, static_cast<std::size_t>(key.size));
+		if(contents.size != key.size) return false;
+
+		// Use a 64-bit FNV-1a.
+		key.hash = 0xcbf29ce484222325;
+		for(const uint8_t byte: contents) {
+			key.hash = (key.hash ^ byte) * 0x100000001b3;
+		}
+		key.name = LeafName(file_name);
+		return true;
+	} catch(...) {
+		return false;
+	}
+}
+
+std::string AnalysisCache::path_for(uint64_t hash) {
+	std::ostringstream path;
+	path << directory_ << '/' << std::hex << std::setw(16) << std::setfill('0') << hash << ".analysis";
+	return path.str();
+}
+
+bool AnalysisCache::find(const Key &key, TargetList &targets, std::vector<MediaFormats> &formats) {
+	TargetList found_targets;
+	std::vector<MediaFormats> found_formats;
+	try {
+		Storage::FileHolder file(path_for(key.hash), Storage::FileHolder::FileMode::MappedRead);
+		Reader reader(file.view(0, static_cast<std::size_t>(file.stats().st_size)));
+
+		// Check that this entry is current and is for this file.
+		if(!reader.check_signature()) return false;
+		if(reader.integer<uint32_t>() != AnalyserVersion) return false;
+		if(reader.integer<uint64_t>() != key.size) return false;
+		std::string name;
+		reader(name);
+		if(name != key.name) return false;
+
+		uint32_t number_of_targets = reader.integer<uint32_t>();
+		while(number_of_targets-- && !reader.overran) {
+			const Analyser::Machine machine = static_cast<Analyser::Machine>(reader.integer<uint8_t>());
+			std::unique_ptr<Target> target(NewTarget(machine));
+			if(!target) return false;
+			target->machine = machine;
+			reader(target->confidence);
+			if(!PlatformFields(reader, *target)) return false;
+
+			found_formats.emplace_back();
+			found_formats.back().disks = ReadStrings(reader);
+			found_formats.back().tapes = ReadStrings(reader);
+
+			uint32_t number_of_cartridges = reader.integer<uint32_t>();
+			while(number_of_cartridges-- && !reader.overran) {
+				CartridgeType type;
+				reader(type);
+				Analyser::Static::MSX::Cartridge::Type msx_type = Analyser::Static::MSX::Cartridge::None;
+				if(type == CartridgeType::MSX) {
+					msx_type = static_cast<Analyser::Static::MSX::Cartridge::Type>(reader.integer<uint8_t>());
+				}
+
+				std::vector<Storage::Cartridge::Cartridge::Segment> segments;
+				uint32_t number_of_segments = reader.integer<uint32_t>();
+				while(number_of_segments-- && !reader.overran) {
+					const std::size_t start_address = static_cast<std::size_t>(reader.integer<uint64_t>());
+					const std::size_t end_address = static_cast<std::size_t>(reader.integer<uint64_t>());
+					segments.emplace_back(start_address, end_address, reader.bytes());
+				}
+
+				switch(type) {
+					default: return false;
+					case CartridgeType::Generic:
+						target->media.cartridges.emplace_back(new Storage::Cartridge::Cartridge(segments));
+					break;
+					case CartridgeType::MSX:
+						target->media.cartridges.emplace_back(new Analyser::Static::MSX::Cartridge(segments, msx_type));
+					break;
+				}
+			}
+
+			found_targets.push_back(std::move(target));
+		}
+
+		if(reader.overran) return false;
+	} catch(...) {
+		return false;
+	}
+
+	targets = std::move(found_targets);
+	formats = std::move(found_formats);
+	return true;
+}
+
+bool AnalysisCache::store(const Key &key, const TargetList &targets, const std::vector<MediaFormats> &formats) {
+	if(formats.size() != targets.size()) return false;
+
+	Writer writer;
+	writer.data.insert(writer.data.end(), Signature, Signature + sizeof(Signature));
+	writer.integer(AnalyserVersion);
+	writer.integer(key.size);
+	std::string name = key.name;
+	writer(name);
+
+	writer.integer(static_cast<uint32_t>(targets.size()));
+	for(std::size_t index = 0; index < targets.size(); ++index) {
+		Target &target = *targets[index];
+		writer.integer(static_cast<uint8_t>(target.machine));
+		writer(target.confidence);
+		if(!PlatformFields(writer, target)) return false;
+
+		WriteStrings(writer, formats[index].disks);
+		WriteStrings(writer, formats[index].tapes);
+
+		writer.integer(static_cast<uint32_t>(target.media.cartridges.size()));
+		for(const auto &cartridge: target.media.cartridges) {
+			const auto *const msx_cartridge = dynamic_cast<const Analyser::Static::MSX::Cartridge *>(cartridge.get());
+			if(msx_cartridge) {
+				CartridgeType type = CartridgeType::MSX;
+				writer(type);
+				writer.integer(static_cast<uint8_t>(msx_cartridge->type));
+			} else {
+				CartridgeType type = CartridgeType::Generic;
+				writer(type);
+			}
+
+			const auto &segments = cartridge->get_segments();
+			writer.integer(static_cast<uint32_t>(segments.size()));
+			for(const auto &segment: segments) {
+				writer.integer(static_cast<uint64_t>(segment.start_address));
+				writer.integer(static_cast<uint64_t>(segment.end_address));
+				writer.bytes(segment.data);
+			}
+		}
+	}
+
+	// Write to a temporary file and then move it into place, so that any other user of this
+	// directory never sees a partial entry. mkstemp picks a name that no other thread or process is using.
+	const std::string path = path_for(key.hash);
+	std::vector<char> temporary_path(path.begin(), path.end());
+	const char suffix[] = ".XXXXXX";
+	temporary_path.insert(temporary_path.end(), suffix, suffix + sizeof(suffix));
+	const int file = mkstemp(temporary_path.data());
+	if(file < 0) return false;
+
+	std::size_t written = 0;
+	while(written < writer.data.size()) {
+		const ssize_t result = write(file, &writer.data[written], writer.data.size() - written);
+		if(result <= 0) break;
+		written += static_cast<std::size_t>(result);
+	}
+	if(close(file) || written != writer.data.size()) {
+		std::remove(temporary_path.data());
+		return false;
+	}
+	if(std::rename(temporary_path.data(), path.c_str())) {
+		std::remove(temporary_path.data());
+		return false;
+	}
+	return true;
+}
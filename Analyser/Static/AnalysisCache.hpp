@@ -0,0 +1,91 @@
+//
+//  AnalysisCache.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef Analyser_Static_AnalysisCache_hpp
+#define Analyser_Static_AnalysisCache_hpp
+
+#include "StaticAnalyser.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Analyser {
+namespace Static {
+
+/*!
+	Retains the results of static analysis on disk, so that a file that has been seen before needn't be
+	analysed again.
+
+	Entries are keyed by a hash of the contents of the file analysed; each also records the final component
+	of the file's name, since analysis is informed by file names, and is ignored if that differs.
+
+	Cartridges are stored in full, since analysers may repackage them. Disks and tapes are stored only as
+	the name of the format from which each was obtained; it is for the caller to reopen them.
+*/
+class AnalysisCache {
+	public:
+		/*!
+			The version of the analysers and of the target descriptions they produce. Entries stored with any other
+			version are ignored, so this should be incremented whenever an analyser changes what it would conclude
+			about any file, or whenever a field is added to or removed from a Target.
+		*/
+		static const uint32_t AnalyserVersion;
+
+		/// Constructs a cache that keeps its entries in @c directory, which should already exist.
+		AnalysisCache(const std::string &directory);
+
+		/// Names, in order, the formats from which each of a target's disks and tapes were obtained.
+		struct MediaFormats {
+			std::vector<std::string> disks;
+			std::vector<std::string> tapes;
+		};
+
+		/// Identifies a file: by a hash of its contents, its size and the final component of its name.
+		struct Key {
+			uint64_t hash = 0;
+			uint64_t size = 0;
+			std::string name;
+		};
+
+		/*!
+			Obtains the key for @c file_name, which requires reading the whole file; the result can then be supplied
+			to any number of calls to @c find and @c store.
+
+			@returns @c true if the file could be read; @c false otherwise.
+		*/
+		bool get_key(const std::string &file_name, Key &key);
+
+		/*!
+			Looks for a stored analysis of the file identified by @c key.
+
+			@param targets If an entry is found, receives the stored targets. Their media will include cartridges but
+				no disks or tapes.
+			@param formats If an entry is found, receives the formats of each target's disks and tapes.
+			@returns @c true if an entry was found; @c false otherwise.
+		*/
+		bool find(const Key &key, TargetList &targets, std::vector<MediaFormats> &formats);
+
+		/*!
+			Stores @c targets as the result of analysing the file identified by @c key, replacing any existing entry.
+
+			@param formats The formats of each target's disks and tapes; this should have one entry per target.
+			@returns @c true if the entry was written; @c false otherwise.
+		*/
+		bool store(const Key &key, const TargetList &targets, const std::vector<MediaFormats> &formats);
+
+	private:
+		std::string directory_;
+
+		std::string path_for(uint64_t hash);
+};
+
+}
+}
+
+#endif /* Analyser_Static_AnalysisCache_hpp */
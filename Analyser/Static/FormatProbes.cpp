@@ -0,0 +1,195 @@
+//
+//  FormatProbes.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "FormatProbes.hpp"
+
+#include "../../Storage/FileHolder.hpp"
+
+#include <cstring>
+
+using namespace Analyser::Static::Probe;
+
+namespace {
+
+Result IdentifiedIf(bool condition) {
+	return condition ? Result::Identified : Result::Rejected;
+}
+
+Result PossibleIf(bool condition) {
+	return condition ? Result::Possible : Result::Rejected;
+}
+
+}
+
+Header::Header(const std::string &file_name) {
+	Storage::FileHolder file(file_name, Storage::FileHolder::FileMode::Read);
+	file_size = static_cast<uint64_t>(file.stats().st_size);
+	data = file.read(Length);
+}
+
+bool Header::matches(std::size_t offset, const char *signature, std::size_t length) const {
+	if(!length) length = std::strlen(signature);
+	return offset + length <= data.size() && !std::memcmp(&data[offset], signature, length);
+}
+
+uint8_t Header::get8(std::size_t offset) const {
+	return (offset < data.size()) ? data[offset] : 0;
+}
+
+uint16_t Header::get16le(std::size_t offset) const {
+	return static_cast<uint16_t>(get8(offset) | (get8(offset + 1) << 8));
+}
+
+uint32_t Header::get32le(std::size_t offset) const {
+	return static_cast<uint32_t>(get16le(offset) | (get16le(offset + 2) << 16));
+}
+
+// MARK: - Cartridges
+
+Result Analyser::Static::Probe::BinaryDump(const Header &) {
+	// Any file at all is a valid binary dump.
+	return Result::Possible;
+}
+
+Result Analyser::Static::Probe::CartridgePRG(const Header &header) {
+	// A load address of 0xa000, contents that round up to a power-of-two size from 1kb to 8kb,
+	// and the auto-start signature.
+	const uint64_t data_size = header.file_size - 2;
+	return IdentifiedIf(
+		header.file_size > 0x200 + 2 &&
+		data_size <= 0x2000 &&
+		header.get16le(0) == 0xa000 &&
+		header.matches(6, "\x41\x30\xc3\xc2\xcd", 5)
+	);
+}
+
+// MARK: - Disks
+
+Result Analyser::Static::Probe::AcornADF(const Header &header) {
+	// A whole number of 256-byte sectors, at least seven of them, and the root directory's two 'Hugo's.
+	return IdentifiedIf(
+		!(header.file_size & 255) &&
+		header.file_size >= 7*256 &&
+		header.matches(513, "Hugo") &&
+		header.matches(0x6fb, "Hugo")
+	);
+}
+
+Result Analyser::Static::Probe::AppleDSK(const Header &header) {
+	// 35 tracks of either 13 or 16 256-byte sectors.
+	return PossibleIf(header.file_size == 35*13*256 || header.file_size == 35*16*256);
+}
+
+Result Analyser::Static::Probe::CPCDSK(const Header &header) {
+	return IdentifiedIf(header.matches(0, "MV - CPC") || header.matches(0, "EXTENDED"));
+}
+
+Result Analyser::Static::Probe::D64(const Header &header) {
+	// 35 or 40 tracks, without error information.
+	return PossibleIf(header.file_size == 174848 || header.file_size == 196608);
+}
+
+Result Analyser::Static::Probe::DMK(const Header &header) {
+	// A write-protect byte of either 0x00 or 0xff, a plausible track length and a zero native-format flag.
+	return PossibleIf(
+		(header.get8(0) == 0x00 || header.get8(0) == 0xff) &&
+		header.get16le(2) >= 0x80 &&
+		header.data.size() >= 16 &&
+		!header.get32le(0xc)
+	);
+}
+
+Result Analyser::Static::Probe::G64(const Header &header) {
+	return IdentifiedIf(header.matches(0, "GCR-1541") && !header.get8(8) && header.data.size() > 8);
+}
+
+Result Analyser::Static::Probe::HFE(const Header &header) {
+	return IdentifiedIf(header.matches(0, "HXCPICFE") && !header.get8(8) && header.data.size() > 8);
+}
+
+Result Analyser::Static::Probe::MSXDSK(const Header &header) {
+	// A whole number of tracks of nine 512-byte sectors; between 40 and 82 of them if single sided,
+	// otherwise an even number of up to 164.
+	const uint64_t track_size = 9*512;
+	const uint64_t track_count = header.file_size / track_size;
+	return PossibleIf(
+		!(header.file_size % track_size) &&
+		track_count >= 40 &&
+		track_count <= 82*2 &&
+		(track_count <= 82 || !(track_count & 1))
+	);
+}
+
+Result Analyser::Static::Probe::NIB(const Header &header) {
+	// 35 tracks of 6656 bytes.
+	return PossibleIf(header.file_size == 35*6656);
+}
+
+Result Analyser::Static::Probe::OricMFMDSK(const Header &header) {
+	const uint32_t geometry_type = header.get32le(16);
+	return IdentifiedIf(header.matches(0, "MFM_DISK") && (geometry_type == 1 || geometry_type == 2));
+}
+
+Result Analyser::Static::Probe::SSD(const Header &header) {
+	// A whole number of 256-byte sectors, from two up to eighty tracks' worth.
+	return PossibleIf(!(header.file_size & 255) && header.file_size >= 512 && header.file_size <= 800*256);
+}
+
+Result Analyser::Static::Probe::WOZ(const Header &header) {
+	return IdentifiedIf(header.matches(0, "WOZ1\xff\n\r\n", 8));
+}
+
+// MARK: - Tapes
+
+Result Analyser::Static::Probe::CAS(const Header &header) {
+	return IdentifiedIf(header.matches(0, "\x1f\xa6\xde\xba\xcc\x13\x7d\x74", 8));
+}
+
+Result Analyser::Static::Probe::CommodoreTAP(const Header &header) {
+	return IdentifiedIf(header.matches(0, "C64-TAPE-RAW") && header.get8(12) <= 1 && header.data.size() > 12);
+}
+
+Result Analyser::Static::Probe::CSW(const Header &header) {
+	// The signature, and a version of either 1.0, 1.1, 2.0 or 2.1.
+	const uint8_t major_version = header.get8(23);
+	const uint8_t minor_version = header.get8(24);
+	return IdentifiedIf(
+		header.file_size >= 0x20 &&
+		header.matches(0, "Compressed Square Wave\x1a") &&
+		major_version && major_version <= 2 && minor_version <= 1
+	);
+}
+
+Result Analyser::Static::Probe::OricTAP(const Header &header) {
+	return IdentifiedIf(header.matches(0, "\x16\x16\x16\x24"));
+}
+
+Result Analyser::Static::Probe::TapePRG(const Header &header) {
+	// A load address plus at least one byte, all of which fits within 64kb.
+	return PossibleIf(
+		header.file_size >= 3 &&
+		header.file_size < 65538 &&
+		header.get16le(0) + (header.file_size - 2) < 65536
+	);
+}
+
+Result Analyser::Static::Probe::TZX(const Header &header) {
+	// The signature, and a version of 1.21 or earlier.
+	return IdentifiedIf(header.matches(0, "ZXTape!\x1a") && header.get8(8) == 1 && header.get8(9) <= 21);
+}
+
+Result Analyser::Static::Probe::UEF(const Header &header) {
+	// UEFs may be gzipped; if so then there's nothing further to inspect without decompressing.
+	if(header.matches(0, "\x1f\x8b", 2)) return Result::Possible;
+	return IdentifiedIf(header.matches(0, "UEF File!", 10));
+}
+
+Result Analyser::Static::Probe::ZX80O81P(const Header &) {
+	// These are raw memory dumps, so anything might be one.
+	return Result::Possible;
+}
@@ -0,0 +1,92 @@
+//
+//  FormatProbes.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef Analyser_Static_FormatProbes_hpp
+#define Analyser_Static_FormatProbes_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Analyser {
+namespace Static {
+
+/*!
+	Provides cheap tests of whether a file might be of each supported format, based only on its size
+	and its first few kilobytes. These allow formats to be excluded without the expense of fully opening
+	the file as each, and allow files to be identified by content where their names don't help.
+
+	Each probe should reject only files that the corresponding format would itself reject.
+*/
+namespace Probe {
+
+/// The outcome of inspecting a file for a particular format.
+enum class Result {
+	/// The file is definitely not of this format.
+	Rejected,
+	/// The file might be of this format, but the format has no signature by which to be sure.
+	Possible,
+	/// The file carries this format's signature.
+	Identified
+};
+
+/// The opening bytes of a file, plus its total size.
+struct Header {
+	/// The number of bytes read from the start of the file.
+	static const std::size_t Length = 4096;
+
+	/// Reads the header of @c file_name; throws if the file can't be opened.
+	Header(const std::string &file_name);
+
+	/// @returns @c true if the file contains @c signature at @c offset; @c false otherwise. If @c length is 0 then
+	/// @c signature is assumed to be a C string and its length is determined automatically.
+	bool matches(std::size_t offset, const char *signature, std::size_t length = 0) const;
+
+	/// @returns The byte at @c offset, or 0 if that is beyond the end of the header.
+	uint8_t get8(std::size_t offset) const;
+	uint16_t get16le(std::size_t offset) const;
+	uint32_t get32le(std::size_t offset) const;
+
+	std::vector<uint8_t> data;
+	uint64_t file_size;
+};
+
+// Cartridges.
+Result BinaryDump(const Header &);
+Result CartridgePRG(const Header &);
+
+// Disks.
+Result AcornADF(const Header &);
+Result AppleDSK(const Header &);
+Result CPCDSK(const Header &);
+Result D64(const Header &);
+Result DMK(const Header &);
+Result G64(const Header &);
+Result HFE(const Header &);
+Result MSXDSK(const Header &);
+Result NIB(const Header &);
+Result OricMFMDSK(const Header &);
+Result SSD(const Header &);
+Result WOZ(const Header &);
+
+// Tapes.
+Result CAS(const Header &);
+Result CommodoreTAP(const Header &);
+Result CSW(const Header &);
+Result OricTAP(const Header &);
+Result TapePRG(const Header &);
+Result TZX(const Header &);
+Result UEF(const Header &);
+Result ZX80O81P(const Header &);
+
+}
+}
+}
+
+#endif /* Analyser_Static_FormatProbes_hpp */
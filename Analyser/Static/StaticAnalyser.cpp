@@ -7,11 +7,16 @@
 //
 
 #include "StaticAnalyser.hpp"
+#include "AnalysisCache.hpp"
+#include "FormatProbes.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iterator>
+#include <map>
+#include <set>
 
 // Analysers
 #include "Acorn/StaticAnalyser.hpp"
@@ -56,86 +61,140 @@
 // Target Platform Types
 #include "../../Storage/TargetPlatforms.hpp"
 
+#include "../../Concurrency/ThreadPool.hpp"
+
 using namespace Analyser::Static;
 
-static Media GetMediaAndPlatforms(const std::string &file_name, TargetPlatform::IntType &potential_platforms) {
+namespace {
+
+/// Maps from each disk and tape to the name of the format from which it was obtained.
+typedef std::map<const void *, std::string> FormatsByMedia;
+
+}
+
+/*!
+	Inspects @c file_name to determine the media it contains, and the platforms it might be for.
+
+	@param formats If not @c nullptr, receives the format of each disk and tape found.
+	@param required_format If not @c nullptr, only the named format is considered.
+*/
+static Media GetMediaAndPlatforms(const std::string &file_name, TargetPlatform::IntType &potential_platforms, FormatsByMedia *formats = nullptr, const std::string *required_format = nullptr) {
 	Media result;
 
 	// Get the extension, if any; it will be assumed that extensions are reliable, so an extension is a broad-phase
 	// test as to file format.
-	std::string::size_type final_dot = file_name.find_last_of(".");
-	if(final_dot == std::string::npos) return result;
-	std::string extension = file_name.substr(final_dot + 1);
-	std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+	std::string extension;
+	const std::string::size_type final_dot = file_name.find_last_of(".");
+	const std::string::size_type final_slash = file_name.find_last_of("/\\");
+	if(final_dot != std::string::npos && (final_slash == std::string::npos || final_dot > final_slash)) {
+		extension = file_name.substr(final_dot + 1);
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+	}
+
+	// Grab the start of the file, so that formats that it definitely isn't can be discarded without being
+	// fully instantiated.
+	std::unique_ptr<Probe::Header> header;
+	try {
+		header.reset(new Probe::Header(file_name));
+	} catch(...) {
+		return result;
+	}
 
 #define Insert(list, class, platforms) \
-	list.emplace_back(new Storage::class(file_name));\
-	potential_platforms |= platforms;\
-	TargetPlatform::TypeDistinguisher *distinguisher = dynamic_cast<TargetPlatform::TypeDistinguisher *>(list.back().get());\
-	if(distinguisher) potential_platforms &= distinguisher->target_platform_type();
+	if(!required_format || *required_format == #class) {\
+		list.emplace_back(new Storage::class(file_name));\
+		if(formats) (*formats)[list.back().get()] = #class;\
+		potential_platforms |= platforms;\
+		TargetPlatform::TypeDistinguisher *distinguisher = dynamic_cast<TargetPlatform::TypeDistinguisher *>(list.back().get());\
+		if(distinguisher) potential_platforms &= distinguisher->target_platform_type();\
+	}
 
 #define TryInsert(list, class, platforms) \
 	try {\
 		Insert(list, class, platforms) \
 	} catch(...) {}
 
-#define Format(ext, list, class, platforms) \
-	if(extension == ext)	{		\
-		TryInsert(list, class, platforms)	\
+	// Formats are first considered by extension, in which case those that would definitely reject this file
+	// are skipped. If the extension isn't recognised, or there isn't one, then any format that positively
+	// identifies the file is used instead; each is inserted only once, for the union of platforms it is
+	// listed against.
+	bool extension_is_known = false;
+	std::set<std::string> identified_formats;
+
+#define Format(ext, list, class, platforms, probe) \
+	if(is_identifying) {\
+		if(Probe::probe(*header) == Probe::Result::Identified) {\
+			if(identified_formats.insert(#class).second) {\
+				TryInsert(list, class, platforms)\
+			} else {\
+				potential_platforms |= platforms;\
+			}\
+		}\
+	} else if(extension == ext) {\
+		extension_is_known = true;\
+		if(Probe::probe(*header) != Probe::Result::Rejected) {\
+			TryInsert(list, class, platforms)\
+		}\
 	}
 
-	Format("80", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081)										// 80
-	Format("81", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081)										// 81
-	Format("a26", result.cartridges, Cartridge::BinaryDump, TargetPlatform::Atari2600)						// A26
-	Format("adf", result.disks, Disk::DiskImageHolder<Storage::Disk::AcornADF>, TargetPlatform::Acorn)		// ADF
-	Format("bin", result.cartridges, Cartridge::BinaryDump, TargetPlatform::AllCartridge)					// BIN
-	Format("cas", result.tapes, Tape::CAS, TargetPlatform::MSX)												// CAS
-	Format("cdt", result.tapes, Tape::TZX, TargetPlatform::AmstradCPC)										// CDT
-	Format("col", result.cartridges, Cartridge::BinaryDump, TargetPlatform::ColecoVision)					// COL
-	Format("csw", result.tapes, Tape::CSW, TargetPlatform::AllTape)											// CSW
-	Format("d64", result.disks, Disk::DiskImageHolder<Storage::Disk::D64>, TargetPlatform::Commodore)		// D64
-	Format("dmk", result.disks, Disk::DiskImageHolder<Storage::Disk::DMK>, TargetPlatform::MSX)				// DMK
-	Format("do", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII)		// DO
-	Format("dsd", result.disks, Disk::DiskImageHolder<Storage::Disk::SSD>, TargetPlatform::Acorn)			// DSD
-	Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::CPCDSK>, TargetPlatform::AmstradCPC)	// DSK (Amstrad CPC)
-	Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII)		// DSK (Apple)
-	Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::MSXDSK>, TargetPlatform::MSX)			// DSK (MSX)
-	Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::OricMFMDSK>, TargetPlatform::Oric)		// DSK (Oric)
-	Format("g64", result.disks, Disk::DiskImageHolder<Storage::Disk::G64>, TargetPlatform::Commodore)		// G64
-	Format(	"hfe",
-			result.disks,
-			Disk::DiskImageHolder<Storage::Disk::HFE>,
-			TargetPlatform::Acorn | TargetPlatform::AmstradCPC | TargetPlatform::Commodore | TargetPlatform::Oric)
-			// HFE (TODO: switch to AllDisk once the MSX stops being so greedy)
-	Format("nib", result.disks, Disk::DiskImageHolder<Storage::Disk::NIB>, TargetPlatform::DiskII)			// NIB
-	Format("o", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081)										// O
-	Format("p", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081)										// P
-	Format("po", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII)		// PO
-	Format("p81", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081)										// P81
-
-	// PRG
-	if(extension == "prg") {
-		// try instantiating as a ROM; failing that accept as a tape
-		try {
-			Insert(result.cartridges, Cartridge::PRG, TargetPlatform::Commodore)
-		} catch(...) {
-			try {
-				Insert(result.tapes, Tape::PRG, TargetPlatform::Commodore)
-			} catch(...) {}
+	for(const bool is_identifying: {false, true}) {
+		if(is_identifying && extension_is_known) break;
+
+		Format("80", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081, ZX80O81P)									// 80
+		Format("81", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081, ZX80O81P)									// 81
+		Format("a26", result.cartridges, Cartridge::BinaryDump, TargetPlatform::Atari2600, BinaryDump)					// A26
+		Format("adf", result.disks, Disk::DiskImageHolder<Storage::Disk::AcornADF>, TargetPlatform::Acorn, AcornADF)	// ADF
+		Format("bin", result.cartridges, Cartridge::BinaryDump, TargetPlatform::AllCartridge, BinaryDump)				// BIN
+		Format("cas", result.tapes, Tape::CAS, TargetPlatform::MSX, CAS)												// CAS
+		Format("cdt", result.tapes, Tape::TZX, TargetPlatform::AmstradCPC, TZX)											// CDT
+		Format("col", result.cartridges, Cartridge::BinaryDump, TargetPlatform::ColecoVision, BinaryDump)				// COL
+		Format("csw", result.tapes, Tape::CSW, TargetPlatform::AllTape, CSW)											// CSW
+		Format("d64", result.disks, Disk::DiskImageHolder<Storage::Disk::D64>, TargetPlatform::Commodore, D64)			// D64
+		Format("dmk", result.disks, Disk::DiskImageHolder<Storage::Disk::DMK>, TargetPlatform::MSX, DMK)				// DMK
+		Format("do", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII, AppleDSK)	// DO
+		Format("dsd", result.disks, Disk::DiskImageHolder<Storage::Disk::SSD>, TargetPlatform::Acorn, SSD)				// DSD
+		Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::CPCDSK>, TargetPlatform::AmstradCPC, CPCDSK)	// DSK (Amstrad CPC)
+		Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII, AppleDSK)	// DSK (Apple)
+		Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::MSXDSK>, TargetPlatform::MSX, MSXDSK)			// DSK (MSX)
+		Format("dsk", result.disks, Disk::DiskImageHolder<Storage::Disk::OricMFMDSK>, TargetPlatform::Oric, OricMFMDSK)	// DSK (Oric)
+		Format("g64", result.disks, Disk::DiskImageHolder<Storage::Disk::G64>, TargetPlatform::Commodore, G64)			// G64
+		Format(	"hfe",
+				result.disks,
+				Disk::DiskImageHolder<Storage::Disk::HFE>,
+				TargetPlatform::Acorn | TargetPlatform::AmstradCPC | TargetPlatform::Commodore | TargetPlatform::Oric,
+				HFE)
+				// HFE (TODO: switch to AllDisk once the MSX stops being so greedy)
+		Format("nib", result.disks, Disk::DiskImageHolder<Storage::Disk::NIB>, TargetPlatform::DiskII, NIB)				// NIB
+		Format("o", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081, ZX80O81P)										// O
+		Format("p", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081, ZX80O81P)										// P
+		Format("po", result.disks, Disk::DiskImageHolder<Storage::Disk::AppleDSK>, TargetPlatform::DiskII, AppleDSK)	// PO
+		Format("p81", result.tapes, Tape::ZX80O81P, TargetPlatform::ZX8081, ZX80O81P)									// P81
+
+		// PRG
+		if(!is_identifying && extension == "prg") {
+			// try instantiating as a ROM; failing that accept as a tape
+			extension_is_known = true;
+			if(Probe::CartridgePRG(*header) != Probe::Result::Rejected) {
+				TryInsert(result.cartridges, Cartridge::PRG, TargetPlatform::Commodore)
+			}
+			if(result.cartridges.empty() && Probe::TapePRG(*header) != Probe::Result::Rejected) {
+				TryInsert(result.tapes, Tape::PRG, TargetPlatform::Commodore)
+			}
 		}
-	}
 
-	Format(	"rom",
-			result.cartridges,
-			Cartridge::BinaryDump,
-			TargetPlatform::AcornElectron | TargetPlatform::ColecoVision | TargetPlatform::MSX)				// ROM
-	Format("ssd", result.disks, Disk::DiskImageHolder<Storage::Disk::SSD>, TargetPlatform::Acorn)			// SSD
-	Format("tap", result.tapes, Tape::CommodoreTAP, TargetPlatform::Commodore)								// TAP (Commodore)
-	Format("tap", result.tapes, Tape::OricTAP, TargetPlatform::Oric)										// TAP (Oric)
-	Format("tsx", result.tapes, Tape::TZX, TargetPlatform::MSX)												// TSX
-	Format("tzx", result.tapes, Tape::TZX, TargetPlatform::ZX8081)											// TZX
-	Format("uef", result.tapes, Tape::UEF, TargetPlatform::Acorn)											// UEF (tape)
-	Format("woz", result.disks, Disk::DiskImageHolder<Storage::Disk::WOZ>, TargetPlatform::DiskII)			// WOZ
+		Format(	"rom",
+				result.cartridges,
+				Cartridge::BinaryDump,
+				TargetPlatform::AcornElectron | TargetPlatform::ColecoVision | TargetPlatform::MSX,
+				BinaryDump)																									// ROM
+		Format("ssd", result.disks, Disk::DiskImageHolder<Storage::Disk::SSD>, TargetPlatform::Acorn, SSD)				// SSD
+		Format("tap", result.tapes, Tape::CommodoreTAP, TargetPlatform::Commodore, CommodoreTAP)						// TAP (Commodore)
+		Format("tap", result.tapes, Tape::OricTAP, TargetPlatform::Oric, OricTAP)										// TAP (Oric)
+		Format("tsx", result.tapes, Tape::TZX, TargetPlatform::MSX, TZX)												// TSX
+		Format("tzx", result.tapes, Tape::TZX, TargetPlatform::ZX8081, TZX)												// TZX
+		Format("uef", result.tapes, Tape::UEF, TargetPlatform::Acorn, UEF)												// UEF (tape)
+		Format("woz", result.disks, Disk::DiskImageHolder<Storage::Disk::WOZ>, TargetPlatform::DiskII, WOZ)				// WOZ
+	}
 
 #undef Format
 #undef Insert
@@ -149,31 +208,183 @@ Media Analyser::Static::GetMedia(const std::string &file_name) {
 	return GetMediaAndPlatforms(file_name, throwaway);
 }
 
-TargetList Analyser::Static::GetTargets(const std::string &file_name) {
+namespace {
+
+/// Describes a platform-specific analyser, and the platforms for which it should be consulted.
+struct PlatformAnalyser {
+	TargetPlatform::IntType platforms;
+	const char *name;
+	TargetList (* get_targets)(const Media &, const std::string &, TargetPlatform::IntType);
+};
+
+const PlatformAnalyser platform_analysers[] = {
+	{TargetPlatform::Acorn,			"Acorn",		Acorn::GetTargets},
+	{TargetPlatform::AmstradCPC,	"AmstradCPC",	AmstradCPC::GetTargets},
+	{TargetPlatform::AppleII,		"AppleII",		AppleII::GetTargets},
+	{TargetPlatform::Atari2600,		"Atari",		Atari::GetTargets},
+	{TargetPlatform::ColecoVision,	"Coleco",		Coleco::GetTargets},
+	{TargetPlatform::Commodore,		"Commodore",	Commodore::GetTargets},
+	{TargetPlatform::DiskII,		"DiskII",		DiskII::GetTargets},
+	{TargetPlatform::MSX,			"MSX",			MSX::GetTargets},
+	{TargetPlatform::Oric,			"Oric",			Oric::GetTargets},
+	{TargetPlatform::ZX8081,		"ZX8081",		ZX8081::GetTargets},
+};
+
+}
+
+namespace {
+
+/*!
+	Determines the formats of the disks and tapes attached to @c target.
+
+	@returns @c true if all were found in @c formats; @c false otherwise.
+*/
+bool GetMediaFormats(const Target &target, const FormatsByMedia &formats, AnalysisCache::MediaFormats &media_formats) {
+	for(const auto &disk: target.media.disks) {
+		const auto format = formats.find(disk.get());
+		if(format == formats.end()) return false;
+		media_formats.disks.push_back(format->second);
+	}
+	for(const auto &tape: target.media.tapes) {
+		const auto format = formats.find(tape.get());
+		if(format == formats.end()) return false;
+		media_formats.tapes.push_back(format->second);
+	}
+	return true;
+}
+
+}
+
+/*!
+	Reopens the disks and tapes named by @c formats, attaching them to @c targets. Each format is opened
+	only once, and the result is shared between all targets that use it.
+
+	@returns @c true if all media could be opened; @c false otherwise.
+*/
+static bool RestoreMedia(const std::string &file_name, TargetList &targets, const std::vector<AnalysisCache::MediaFormats> &formats) {
+	std::map<std::string, Media> media_by_format;
+	const auto media_for_format = [&] (const std::string &format) -> const Media & {
+		auto media = media_by_format.find(format);
+		if(media == media_by_format.end()) {
+			TargetPlatform::IntType throwaway = 0;
+			media = media_by_format.insert(std::make_pair(format, GetMediaAndPlatforms(file_name, throwaway, nullptr, &format))).first;
+		}
+		return media->second;
+	};
+
+	for(std::size_t index = 0; index < targets.size(); ++index) {
+		for(const auto &format: formats[index].disks) {
+			const Media &media = media_for_format(format);
+			if(media.disks.empty()) return false;
+			targets[index]->media.disks.push_back(media.disks.front());
+		}
+		for(const auto &format: formats[index].tapes) {
+			const Media &media = media_for_format(format);
+			if(media.tapes.empty()) return false;
+			targets[index]->media.tapes.push_back(media.tapes.front());
+		}
+	}
+	return true;
+}
+
+/*!
+	Sorts @c targets by initial confidence. Uses a stable sort in case any of the machine-specific analysers
+	picked their insertion order carefully.
+*/
+static void SortByConfidence(TargetList &targets) {
+	std::stable_sort(targets.begin(), targets.end(),
+		[] (const std::unique_ptr<Target> &a, const std::unique_ptr<Target> &b) {
+			return a->confidence > b->confidence;
+		});
+}
+
+TargetList Analyser::Static::GetTargets(const std::string &file_name, std::vector<AnalyserTiming> *timings, AnalysisCache *cache) {
 	TargetList targets;
 
+	// Check for a previous analysis of this file. Obtaining the key means reading the whole file, so it is
+	// obtained only once and kept for storing the new analysis upon a miss.
+	AnalysisCache::Key cache_key;
+	if(cache && !cache->get_key(file_name, cache_key)) cache = nullptr;
+	if(cache) {
+		std::vector<AnalysisCache::MediaFormats> formats;
+		if(cache->find(cache_key, targets, formats) && RestoreMedia(file_name, targets, formats)) {
+			SortByConfidence(targets);
+			return targets;
+		}
+		targets.clear();
+	}
+
 	// Collect all disks, tapes and ROMs as can be extrapolated from this file, forming the
 	// union of all platforms this file might be a target for.
 	TargetPlatform::IntType potential_platforms = 0;
-	Media media = GetMediaAndPlatforms(file_name, potential_platforms);
+	FormatsByMedia media_formats;
+	Media media = GetMediaAndPlatforms(file_name, potential_platforms, &media_formats);
+
+	// Determine which platform-specific analysers have an interest in this file.
+	std::vector<const PlatformAnalyser *> applicable_analysers;
+	for(const auto &analyser: platform_analysers) {
+		if(potential_platforms & analyser.platforms) applicable_analysers.push_back(&analyser);
+	}
 
 	// Hand off to platform-specific determination of whether these things are actually compatible and,
-	// if so, how to load them.
-	#define Append(x) {\
-		auto new_targets = x::GetTargets(media, file_name, potential_platforms);\
-		std::move(new_targets.begin(), new_targets.end(), std::back_inserter(targets));\
+	// if so, how to load them. If the host has more than one core then the analysers are run concurrently;
+	// analysing media usually means playing tapes and spinning disks, so in that case each analyser other
+	// than the first is given its own copy of the media.
+	Concurrency::ThreadPool &thread_pool = Concurrency::ThreadPool::shared();
+	const bool run_concurrently = applicable_analysers.size() > 1 && thread_pool.size() > 1;
+	std::vector<TargetList> analyser_targets(applicable_analysers.size());
+	std::vector<double> durations(applicable_analysers.size());
+
+	// If there's a cache, also note the formats of each target's media so that it can be reopened later.
+	std::vector<std::vector<AnalysisCache::MediaFormats>> analyser_formats(applicable_analysers.size());
+	std::vector<char> analyser_formats_are_complete(applicable_analysers.size(), true);
+
+	const auto analyse = [&] (std::size_t index) {
+		const auto start_time = std::chrono::steady_clock::now();
+
+		const Media *analysed_media = &media;
+		const FormatsByMedia *analysed_media_formats = &media_formats;
+		Media independent_media;
+		FormatsByMedia independent_media_formats;
+		if(index && run_concurrently) {
+			TargetPlatform::IntType throwaway = 0;
+			independent_media = GetMediaAndPlatforms(file_name, throwaway, &independent_media_formats);
+			analysed_media = &independent_media;
+			analysed_media_formats = &independent_media_formats;
+		}
+
+		analyser_targets[index] = applicable_analysers[index]->get_targets(*analysed_media, file_name, potential_platforms);
+		if(cache) {
+			for(const auto &target: analyser_targets[index]) {
+				analyser_formats[index].emplace_back();
+				analyser_formats_are_complete[index] &= GetMediaFormats(*target, *analysed_media_formats, analyser_formats[index].back());
+			}
+		}
+
+		durations[index] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	};
+	if(run_concurrently) {
+		thread_pool.parallel_for(applicable_analysers.size(), analyse);
+	} else {
+		for(std::size_t index = 0; index < applicable_analysers.size(); ++index) analyse(index);
+	}
+
+	// Merge results in a fixed order, so that the outcome doesn't depend on scheduling.
+	std::vector<AnalysisCache::MediaFormats> formats;
+	bool formats_are_complete = true;
+	for(std::size_t index = 0; index < applicable_analysers.size(); ++index) {
+		std::move(analyser_targets[index].begin(), analyser_targets[index].end(), std::back_inserter(targets));
+		std::move(analyser_formats[index].begin(), analyser_formats[index].end(), std::back_inserter(formats));
+		formats_are_complete &= !!analyser_formats_are_complete[index];
+		if(timings) {
+			timings->push_back({applicable_analysers[index]->name, durations[index], analyser_targets[index].size()});
+		}
+	}
+
+	// Retain this analysis for next time, if possible.
+	if(cache && formats_are_complete) {
+		cache->store(cache_key, targets, formats);
 	}
-	if(potential_platforms & TargetPlatform::Acorn)			Append(Acorn);
-	if(potential_platforms & TargetPlatform::AmstradCPC)	Append(AmstradCPC);
-	if(potential_platforms & TargetPlatform::AppleII)		Append(AppleII);
-	if(potential_platforms & TargetPlatform::Atari2600)		Append(Atari);
-	if(potential_platforms & TargetPlatform::ColecoVision)	Append(Coleco);
-	if(potential_platforms & TargetPlatform::Commodore)		Append(Commodore);
-	if(potential_platforms & TargetPlatform::DiskII)		Append(DiskII);
-	if(potential_platforms & TargetPlatform::MSX)			Append(MSX);
-	if(potential_platforms & TargetPlatform::Oric)			Append(Oric);
-	if(potential_platforms & TargetPlatform::ZX8081)		Append(ZX8081);
-	#undef Append
 
 	// Reset any tapes to their initial position
 	for(const auto &target : targets) {
@@ -182,12 +393,6 @@ TargetList Analyser::Static::GetTargets(const std::string &file_name) {
 		}
 	}
 
-	// Sort by initial confidence. Use a stable sort in case any of the machine-specific analysers
-	// picked their insertion order carefully.
-	std::stable_sort(targets.begin(), targets.end(),
-		[] (const std::unique_ptr<Target> &a, const std::unique_ptr<Target> &b) {
-			return a->confidence > b->confidence;
-		});
-
+	SortByConfidence(targets);
 	return targets;
 }
@@ -15,6 +15,7 @@
 #include "../../Storage/Disk/Disk.hpp"
 #include "../../Storage/Cartridge/Cartridge.hpp"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,16 +45,33 @@ struct Target {
 
 	Machine machine;
 	Media media;
-	float confidence;
+	float confidence = 0.0f;
 };
 typedef std::vector<std::unique_ptr<Target>> TargetList;
 
+class AnalysisCache;
+
+/*!
+	Records the time spent by one of the platform-specific analysers while evaluating a file.
+*/
+struct AnalyserTiming {
+	std::string name;
+	double seconds;
+	std::size_t number_of_targets;
+};
+
 /*!
 	Attempts, through any available means, to return a list of potential targets for the file with the given name.
 
+	On hosts with more than one core, each platform-specific analyser that might be interested in the file is
+	run concurrently, upon its own copy of the file's media.
+
+	@param timings If not @c nullptr, receives the time spent by each analyser that was run, in platform order.
+	@param cache If not @c nullptr, is consulted before any analysis is performed, and is updated with the
+		results of any analysis that is performed.
 	@returns The list of potential targets, sorted from most to least probable.
 */
-TargetList GetTargets(const std::string &file_name);
+TargetList GetTargets(const std::string &file_name, std::vector<AnalyserTiming> *timings = nullptr, AnalysisCache *cache = nullptr);
 
 /*!
 	Inspects the supplied file and determines the media included.
@@ -9,6 +9,8 @@
 #ifndef ClockReceiver_hpp
 #define ClockReceiver_hpp
 
+#include <limits>
+
 /*
 	Informal pattern for all classes that run from a clock cycle:
 
@@ -120,6 +122,9 @@ template <class T> class WrappedInt {
 
 		inline int as_int() const { return length_; }
 
+		/// @returns The largest representable length; can be used to indicate 'never'.
+		static inline T max() { return T(std::numeric_limits<int>::max()); }
+
 		/*!
 			Severs from @c this the effect of dividing by @c divisor; @c this will end up with
 			the value of @c this modulo @c divisor and @c divided by @c divisor is returned.
@@ -209,6 +214,12 @@ template <class T> class HalfClockReceiver: public T {
 			T::run_for(half_cycles_.flush_cycles());
 		}
 
+		/// Records or restores the wrapped receiver's state, plus any half cycle not yet passed to it.
+		template <typename ArchiveT> void serialise(ArchiveT &archive) {
+			T::serialise(archive);
+			archive(half_cycles_);
+		}
+
 	private:
 		HalfCycles half_cycles_;
 };
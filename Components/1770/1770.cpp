@@ -784,3 +784,11 @@ void WD1770::set_head_loaded(bool head_loaded) {
 	head_is_loaded_ = head_loaded;
 	if(head_loaded) posit_event(static_cast<int>(Event1770::HeadLoad));
 }
+
+void WD1770::serialise(State::Archive &archive) {
+	archive.tag("WD1770");
+	MFMController::serialise(archive);
+	archive(status_, track_, sector_, data_, command_);
+	archive(index_hole_count_, index_hole_count_target_, distance_into_section_, step_direction_);
+	archive(interesting_event_mask_, resume_point_, delay_time_, header_, head_is_loaded_);
+}
@@ -74,6 +74,12 @@ class WD1770: public Storage::Disk::MFMController {
 		};
 		inline void set_delegate(Delegate *delegate)	{	delegate_ = delegate;			}
 
+		/*!
+			Records or restores the controller's registers, command progress and PLL state. The current
+			drive is not included and should be serialised by its owner.
+		*/
+		void serialise(State::Archive &archive);
+
 	protected:
 		virtual void set_head_load_request(bool head_load);
 		virtual void set_motor_on(bool motor_on);
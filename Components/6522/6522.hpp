@@ -16,6 +16,7 @@
 #include "Implementation/6522Storage.hpp"
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace MOS {
 namespace MOS6522 {
@@ -85,9 +86,22 @@ class MOS6522Base: public MOS6522Storage {
 		/// @returns @c true if the IRQ line is currently active; @c false otherwise.
 		bool get_interrupt_line();
 
+		/*!
+			@returns the number of half cycles that may elapse before this VIA next changes its interrupt output,
+			assuming no intervening register accesses or control line changes; @c HalfCycles::max() if no change
+			is currently scheduled. Owners may accumulate time and run the VIA only upon reaching this point, or
+			upon any register access or input change, without any observable difference.
+		*/
+		HalfCycles get_next_sequence_point() const;
+
+		/// Records or restores the VIA's registers, timers and control line state.
+		void serialise(State::Archive &archive);
+
 	private:
 		inline void do_phase1();
 		inline void do_phase2();
+		inline int quiet_cycles() const;
+		inline void advance_timers(int cycles);
 		virtual void reevaluate_interrupts() = 0;
 };
 
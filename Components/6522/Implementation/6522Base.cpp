@@ -8,6 +8,9 @@
 
 #include "../6522.hpp"
 
+#include <algorithm>
+#include <limits>
+
 using namespace MOS::MOS6522;
 
 void MOS6522Base::set_control_line_input(Port port, Line line, bool value) {
@@ -77,22 +80,48 @@ void MOS6522Base::do_phase1() {
 	}
 }
 
+/*!
+	@returns the number of whole cycles, starting from the beginning of phase 1, for which both timers
+	will merely count down; i.e. during which no reload or interrupt can occur.
+*/
+int MOS6522Base::quiet_cycles() const {
+	if(registers_.timer_needs_reload || registers_.next_timer[0] >= 0 || registers_.next_timer[1] >= 0) return 0;
+
+	int quiet_cycles = std::numeric_limits<int>::max();
+	for(int c = 0; c < 2; ++c) {
+		if(!timer_is_running_[c]) continue;
+
+		// A running timer that has just wrapped will signal in this phase 1; otherwise it will
+		// next wrap, and then signal, when it has counted down through zero.
+		if(registers_.timer[c] == 0xffff && !registers_.last_timer[c]) return 0;
+		quiet_cycles = std::min(quiet_cycles, registers_.timer[c] + 1);
+	}
+	return quiet_cycles;
+}
+
+/*!
+	Advances both timers by @c cycles whole cycles, which must be no greater than the current value of @c quiet_cycles().
+*/
+void MOS6522Base::advance_timers(int cycles) {
+	for(int c = 0; c < 2; ++c) {
+		registers_.last_timer[c] = static_cast<uint16_t>(registers_.timer[c] - (cycles - 1));
+		registers_.timer[c] = static_cast<uint16_t>(registers_.timer[c] - cycles);
+	}
+}
+
 /*! Runs for a specified number of half cycles. */
 void MOS6522Base::run_for(const HalfCycles half_cycles) {
 	int number_of_half_cycles = half_cycles.as_int();
+	if(!number_of_half_cycles) return;
 
 	if(is_phase2_) {
 		do_phase2();
 		number_of_half_cycles--;
 	}
 
-	while(number_of_half_cycles >= 2) {
-		do_phase1();
-		do_phase2();
-		number_of_half_cycles -= 2;
-	}
+	run_for(Cycles(number_of_half_cycles >> 1));
 
-	if(number_of_half_cycles) {
+	if(number_of_half_cycles & 1) {
 		do_phase1();
 		is_phase2_ = true;
 	} else {
@@ -103,10 +132,52 @@ void MOS6522Base::run_for(const HalfCycles half_cycles) {
 /*! Runs for a specified number of cycles. */
 void MOS6522Base::run_for(const Cycles cycles) {
 	int number_of_cycles = cycles.as_int();
-	while(number_of_cycles--) {
-		do_phase1();
-		do_phase2();
+	while(number_of_cycles) {
+		// Periods in which the timers do nothing but count are applied in bulk; everything
+		// else is stepped through a cycle at a time.
+		const int quiet = std::min(number_of_cycles, quiet_cycles());
+		if(quiet) {
+			advance_timers(quiet);
+			number_of_cycles -= quiet;
+		} else {
+			do_phase1();
+			do_phase2();
+			--number_of_cycles;
+		}
+	}
+}
+
+HalfCycles MOS6522Base::get_next_sequence_point() const {
+	// A pending reload or newly-written timer value will be applied during the next phase 2; be
+	// conservative and ask to be run through that before predicting anything further.
+	if(registers_.timer_needs_reload || registers_.next_timer[0] >= 0 || registers_.next_timer[1] >= 0) return HalfCycles(1);
+
+	int next_event = std::numeric_limits<int>::max();
+	const uint8_t timer_flags[2] = {InterruptFlag::Timer1, InterruptFlag::Timer2};
+	for(int c = 0; c < 2; ++c) {
+		// Only a timer that is running, enabled as an interrupt source and not already signalling can change the interrupt output.
+		if(	!timer_is_running_[c] ||
+			!(registers_.interrupt_enable & timer_flags[c]) ||
+			(registers_.interrupt_flags & timer_flags[c])) continue;
+
+		// Establish the timer's state at the start of the next phase 1, and the number of half cycles until then.
+		int timer = registers_.timer[c];
+		int last_timer = registers_.last_timer[c];
+		int offset = 0;
+		if(is_phase2_) {
+			last_timer = timer;
+			timer = (timer - 1) & 0xffff;
+			offset = 1;
+		}
+
+		// The interrupt is signalled in the phase 1 that follows the timer counting down through zero.
+		if(timer == 0xffff && !last_timer) {
+			next_event = std::min(next_event, offset + 1);
+		} else {
+			next_event = std::min(next_event, offset + 2*timer + 3);
+		}
 	}
+	return HalfCycles(next_event);
 }
 
 /*! @returns @c true if the IRQ line is currently active; @c false otherwise. */
@@ -114,3 +185,8 @@ bool MOS6522Base::get_interrupt_line() {
 	uint8_t interrupt_status = registers_.interrupt_flags & registers_.interrupt_enable & 0x7f;
 	return !!interrupt_status;
 }
+
+void MOS6522Base::serialise(State::Archive &archive) {
+	archive.tag("MOS6522");
+	archive(is_phase2_, registers_, control_inputs_, timer_is_running_, last_posted_interrupt_status_);
+}
@@ -13,6 +13,7 @@
 #include <cstdio>
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace MOS {
 
@@ -146,6 +147,12 @@ template <class T> class MOS6532 {
 			return interrupt_line_;
 		}
 
+		/// Records or restores the RIOT's RAM, timer, port and interrupt state.
+		void serialise(State::Archive &archive) {
+			archive.tag("MOS6532");
+			archive(ram_, timer_, a7_interrupt_, port_, interrupt_status_, interrupt_line_);
+		}
+
 	private:
 		uint8_t ram_[128];
 
@@ -139,3 +139,8 @@ void AudioGenerator::set_sample_volume_range(std::int16_t range) {
 #undef shift
 #undef increment
 #undef update
+
+void AudioGenerator::serialise(State::Archive &archive) {
+	archive.tag("MOS6560Audio");
+	archive(counters_, shift_registers_, control_registers_, volume_);
+}
@@ -14,6 +14,7 @@
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
+#include "../../State/Archive.hpp"
 
 namespace MOS {
 namespace MOS6560 {
@@ -31,6 +32,9 @@ class AudioGenerator: public ::Outputs::Speaker::SampleSource {
 		void skip_samples(std::size_t number_of_samples);
 		void set_sample_volume_range(std::int16_t range);
 
+		/// Records or restores the generator's counters and registers; should be called only while the audio queue is idle.
+		void serialise(State::Archive &archive);
+
 	private:
 		Concurrency::DeferringAsyncTaskQueue &audio_queue_;
 
@@ -62,9 +66,9 @@ enum class OutputMode {
 */
 template <class BusHandler> class MOS6560 {
 	public:
-		MOS6560(BusHandler &bus_handler) :
+		MOS6560(BusHandler &bus_handler, Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL) :
 				bus_handler_(bus_handler),
-				crt_(new Outputs::CRT::CRT(65*4, 4, Outputs::CRT::DisplayType::NTSC60, 2)),
+				crt_(new Outputs::CRT::CRT(65*4, 4, Outputs::CRT::DisplayType::NTSC60, 2, backend)),
 				audio_generator_(audio_queue_),
 				speaker_(audio_generator_)
 		{
@@ -78,6 +82,12 @@ template <class BusHandler> class MOS6560 {
 
 					"return vec2(yc.x, chroma);"
 				"}");
+			crt_->set_software_sampling_function([] (const uint8_t *sample, unsigned int) -> uint32_t {
+				return Outputs::CRT::software_colour_for_chrominance(
+					static_cast<float>(sample[0]) / 255.0f,
+					6.283185308f * 2.0f * static_cast<float>(sample[1]) / 255.0f,
+					(sample[1] > 191) ? 0.0f : 1.0f);
+			});
 
 			// default to s-video output
 			crt_->set_video_signal(Outputs::CRT::VideoSignal::SVideo);
@@ -436,6 +446,29 @@ template <class BusHandler> class MOS6560 {
 			}
 		}
 
+		/*!
+			Records or restores the VIC's registers, raster and fetch state, and audio generator. If pixels
+			were being output, output of the current run resumes in a fresh buffer upon restoration.
+		*/
+		void serialise(State::Archive &archive) {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag("MOS6560");
+			audio_generator_.serialise(archive);
+			archive(cycles_since_speaker_update_, registers_, this_state_, output_state_, cycles_in_state_);
+			archive(horizontal_counter_, vertical_counter_, vertical_drawing_latch_, horizontal_drawing_latch_, rows_this_field_, columns_this_line_);
+			archive(pixel_line_cycle_, column_counter_, current_row_, current_character_row_, video_matrix_address_counter_, base_video_matrix_address_counter_);
+			archive(character_code_, character_colour_, character_value_, is_odd_frame_, is_odd_line_);
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				pixel_pointer = nullptr;
+				if(output_state_ == State::Pixels) {
+					pixel_pointer = reinterpret_cast<uint16_t *>(crt_->allocate_write_area(260));
+				}
+			}
+		}
+
 	private:
 		BusHandler &bus_handler_;
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
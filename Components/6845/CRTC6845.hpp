@@ -10,6 +10,7 @@
 #define CRTC6845_hpp
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -164,6 +165,15 @@ template <class T> class CRTC6845 {
 			return bus_state_;
 		}
 
+		/// Records or restores the CRTC's registers and counters.
+		void serialise(State::Archive &archive) {
+			archive.tag("CRTC6845");
+			archive(bus_state_, registers_, dummy_register_, selected_register_);
+			archive(character_counter_, line_counter_, character_is_visible_, line_is_visible_);
+			archive(hsync_counter_, vsync_counter_, is_in_adjustment_period_);
+			archive(line_address_, end_of_line_address_, status_, display_skew_mask_, character_is_visible_shifter_);
+		}
+
 	private:
 		inline void perform_bus_cycle_phase1() {
 			// Skew theory of operation: keep a history of the last three states, and apply whichever is selected.
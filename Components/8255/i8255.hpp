@@ -9,6 +9,8 @@
 #ifndef i8255_hpp
 #define i8255_hpp
 
+#include "../../State/Archive.hpp"
+
 namespace Intel {
 namespace i8255 {
 
@@ -74,6 +76,15 @@ template <class T> class i8255 {
 			return 0xff;
 		}
 
+		/*!
+			Records or restores the control and output registers. Port handlers are not informed of
+			restored outputs; the owner is responsible for restoring any state that it derives from them.
+		*/
+		void serialise(State::Archive &archive) {
+			archive.tag("i8255");
+			archive(control_, outputs_);
+		}
+
 	private:
 		void update_outputs() {
 			if(!(control_ & 0x10)) port_handler_.set_value(0, outputs_[0]);
@@ -870,3 +870,20 @@ void i8272::set_data_input(uint8_t value) {
 uint8_t i8272::get_data_output() {
 	return 0xff;
 }
+
+void i8272::serialise(State::Archive &archive) {
+	archive.tag("i8272");
+	MFMController::serialise(archive);
+	archive(main_status_, status_);
+	archive.vector(command_);
+	archive.vector(result_stack_);
+	archive(input_, has_input_, expects_input_, interesting_event_mask_, resume_point_, is_access_command_, delay_time_);
+	archive(drives_, drives_seeking_, step_rate_time_, head_unload_time_, head_load_time_, dma_mode_, is_executing_, head_timers_running_);
+	archive(header_, distance_into_section_, index_hole_count_, index_hole_limit_, active_drive_, active_head_);
+	archive(cylinder_, head_, sector_, size_, is_sleeping_);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		select_drive(active_drive_);
+		update_sleep_observer();
+	}
+}
@@ -41,6 +41,13 @@ class i8272: public Storage::Disk::MFMController {
 
 		bool is_sleeping();
 
+		/*!
+			Records or restores the controller's registers, command progress, per-drive seek state and PLL state.
+			Upon restoration the drive in use by the current command is reselected. Drives themselves are not
+			included and should be serialised by their owner.
+		*/
+		void serialise(State::Archive &archive);
+
 	protected:
 		virtual void select_drive(int number) = 0;
 
@@ -83,12 +83,12 @@ enum ScreenMode {
 
 }
 
-TMS9918Base::TMS9918Base() :
+TMS9918Base::TMS9918Base(Outputs::CRT::OutputBackend backend) :
 	// 342 internal cycles are 228/227.5ths of a line, so 341.25 cycles should be a whole
 	// line. Therefore multiply everything by four, but set line length to 1365 rather than 342*4 = 1368.
-	crt_(new Outputs::CRT::CRT(1365, 4, Outputs::CRT::DisplayType::NTSC60, 4)) {}
+	crt_(new Outputs::CRT::CRT(1365, 4, Outputs::CRT::DisplayType::NTSC60, 4, backend)) {}
 
-TMS9918::TMS9918(Personality p) {
+TMS9918::TMS9918(Personality p, Outputs::CRT::OutputBackend backend) : TMS9918Base(backend) {
 	// Unimaginatively, this class just passes RGB through to the shader. Investigation is needed
 	// into whether there's a more natural form.
 	crt_->set_rgb_sampling_function(
@@ -96,6 +96,9 @@ TMS9918::TMS9918(Personality p) {
 		"{"
 			"return texture(sampler, coordinate).rgb / vec3(255.0);"
 		"}");
+	crt_->set_software_sampling_function([] (const uint8_t *sample, unsigned int) -> uint32_t {
+		return static_cast<uint32_t>((sample[0] << 16) | (sample[1] << 8) | sample[2]);
+	});
 	crt_->set_video_signal(Outputs::CRT::VideoSignal::RGB);
 	crt_->set_visible_area(Outputs::CRT::Rect(0.055f, 0.025f, 0.9f, 0.9f));
 	crt_->set_input_gamma(2.8f);
@@ -711,3 +714,23 @@ uint8_t TMS9918::get_register(int address) {
 bool TMS9918::get_interrupt_line() {
 	return (status_ & StatusInterrupt) && generate_interrupts_;
 }
+
+void TMS9918::serialise(State::Archive &archive) {
+	archive.tag("TMS9918");
+	archive.bytes(ram_, sizeof(ram_));
+	archive(ram_pointer_, read_ahead_buffer_, queued_access_, status_, write_phase_, low_write_);
+	archive(next_screen_mode_, screen_mode_, next_blank_screen_, blank_screen_, sprites_16x16_, sprites_magnified_, generate_interrupts_, sprite_height_);
+	archive(pattern_name_address_, colour_table_address_, pattern_generator_table_address_, sprite_attribute_table_address_, sprite_generator_table_address_);
+	archive(text_colour_, background_colour_);
+	archive(half_cycles_into_frame_, column_, row_, output_column_, cycles_error_, frame_lines_, first_vsync_line_);
+	archive(line_mode_, first_pixel_column_, first_right_border_column_);
+	archive(pattern_names_, pattern_buffer_, colour_buffer_, sprite_sets_, active_sprite_set_, sprites_stopped_, access_pointer_);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		pixel_base_ = pixel_target_ = nullptr;
+		if(row_ < 192 && !blank_screen_ && output_column_ >= first_pixel_column_ && output_column_ < first_right_border_column_) {
+			pixel_base_ = reinterpret_cast<uint32_t *>(crt_->allocate_write_area(static_cast<unsigned int>(first_right_border_column_ - first_pixel_column_)));
+			if(pixel_base_) pixel_target_ = pixel_base_ + output_column_ - first_pixel_column_;
+		}
+	}
+}
@@ -11,6 +11,7 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 #include "Implementation/9918Base.hpp"
 
@@ -38,8 +39,9 @@ class TMS9918: public TMS9918Base {
 		/*!
 			Constructs an instance of the drive controller that behaves according to personality @c p.
 			@param p The type of controller to emulate.
+			@param backend The output backend to use for the CRT this TMS will create.
 		*/
-		TMS9918(Personality p);
+		TMS9918(Personality p, Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL);
 
 		enum TVStandard {
 			/*! i.e. 50Hz output at around 312.5 lines/field */
@@ -79,6 +81,12 @@ class TMS9918: public TMS9918Base {
 			@returns @c true if the interrupt line is currently active; @c false otherwise.
 		*/
 		bool get_interrupt_line();
+
+		/*!
+			Records or restores the VDP's RAM, registers and raster position. If a line was partway through
+			pixel output then, upon restoration, its remaining pixels are output into a fresh buffer.
+		*/
+		void serialise(State::Archive &archive);
 };
 
 };
@@ -19,7 +19,7 @@ namespace TI {
 
 class TMS9918Base {
 	protected:
-		TMS9918Base();
+		TMS9918Base(Outputs::CRT::OutputBackend backend);
 
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
 
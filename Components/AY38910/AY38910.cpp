@@ -8,6 +8,7 @@
 
 #include "AY38910.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 using namespace GI::AY38910;
@@ -70,6 +71,48 @@ void AY38910::set_sample_volume_range(std::int16_t range) {
 	evaluate_output_volume();
 }
 
+namespace {
+
+/*!
+	Advances by @c ticks a counter that counts down to zero and then, upon the next tick, reloads
+	from @c period.
+
+	@returns the number of reloads.
+*/
+int advance_counter(int &counter, int period, int ticks) {
+	if(ticks <= counter) {
+		counter -= ticks;
+		return 0;
+	}
+
+	ticks -= counter + 1;
+	counter = period - ticks % (period + 1);
+	return 1 + ticks / (period + 1);
+}
+
+}
+
+void AY38910::step_noise(int steps) {
+	// The shift register is 17 bits long with feedback from bits 0 and 3, so the next 14 bits
+	// to be fed back are all already present and can be shifted in together.
+	while(steps) {
+		const int batch = std::min(steps, 14);
+		const int mask = (1 << batch) - 1;
+
+		// Output toggles once for every 1 shifted out.
+		int outgoing = noise_shift_register_ & mask;
+		outgoing ^= outgoing >> 8;
+		outgoing ^= outgoing >> 4;
+		outgoing ^= outgoing >> 2;
+		outgoing ^= outgoing >> 1;
+		noise_output_ ^= outgoing & 1;
+
+		const int feedback = (noise_shift_register_ ^ (noise_shift_register_ >> 3)) & mask;
+		noise_shift_register_ = (noise_shift_register_ >> batch) | (feedback << (17 - batch));
+		steps -= batch;
+	}
+}
+
 void AY38910::get_samples(std::size_t number_of_samples, int16_t *target) {
 	std::size_t c = 0;
 	while((master_divider_&7) && c < number_of_samples) {
@@ -78,7 +121,53 @@ void AY38910::get_samples(std::size_t number_of_samples, int16_t *target) {
 		c++;
 	}
 
+	// Determine which generators can currently affect the output. A channel that is fixed at volume 0
+	// is silent regardless of its tone and noise; one with its tone or noise disabled ignores that.
+	bool tone_is_audible[3];
+	bool noise_is_audible = false;
+	bool envelope_is_audible = false;
+	for(int channel = 0; channel < 3; ++channel) {
+		const int volume = output_registers_[8 + channel] & 0x1f;
+		tone_is_audible[channel] = volume && !((output_registers_[7] >> channel) & 1);
+		noise_is_audible |= volume && !((output_registers_[7] >> (channel + 3)) & 1);
+		envelope_is_audible |= !!(volume & 0x10);
+	}
+
 	while(c < number_of_samples) {
+		// Output can change only when an audible generator's counter underflows; until then output
+		// that many ticks' worth of samples in one go, advancing everything else arithmetically.
+		const std::size_t samples_remaining = number_of_samples - c;
+		int quiet_ticks = static_cast<int>(std::min((samples_remaining + 7) >> 3, static_cast<std::size_t>(65536)));
+		for(int channel = 0; channel < 3; ++channel) {
+			if(tone_is_audible[channel]) quiet_ticks = std::min(quiet_ticks, tone_counters_[channel]);
+		}
+		if(noise_is_audible) quiet_ticks = std::min(quiet_ticks, noise_counter_);
+		if(envelope_is_audible) quiet_ticks = std::min(quiet_ticks, envelope_divider_);
+
+		if(quiet_ticks) {
+			for(int channel = 0; channel < 3; ++channel) {
+				tone_outputs_[channel] ^= advance_counter(tone_counters_[channel], tone_periods_[channel], quiet_ticks) & 1;
+			}
+
+			step_noise(advance_counter(noise_counter_, noise_period_, quiet_ticks));
+
+			const int envelope_steps = advance_counter(envelope_divider_, envelope_period_, quiet_ticks);
+			if(envelope_steps) {
+				// Positions beyond 31 either wrap or, for non-repeating shapes, stick at 31.
+				envelope_position_ = envelope_overflow_masks_[output_registers_[13]] ?
+					std::min(envelope_position_ + envelope_steps, 31) :
+					(envelope_position_ + envelope_steps) & 31;
+			}
+
+			const std::size_t samples = std::min(static_cast<std::size_t>(quiet_ticks) << 3, samples_remaining);
+			const int16_t output_volume = output_volume_;	// A local copy can't be aliased by target.
+			std::fill(&target[c], &target[c + samples], output_volume);
+			c += samples;
+			master_divider_ += static_cast<int>(samples);
+			continue;
+		}
+
+		// Otherwise perform a single tick in full.
 #define step_channel(c) \
 	if(tone_counters_[c]) tone_counters_[c]--;\
 	else {\
@@ -93,14 +182,11 @@ void AY38910::get_samples(std::size_t number_of_samples, int16_t *target) {
 
 #undef step_channel
 
-		// ... the noise generator. This recomputes the new bit repeatedly but harmlessly, only shifting
-		// it into the official 17 upon divider underflow.
+		// ... the noise generator.
 		if(noise_counter_) noise_counter_--;
 		else {
 			noise_counter_ = noise_period_;
-			noise_output_ ^= noise_shift_register_&1;
-			noise_shift_register_ |= ((noise_shift_register_ ^ (noise_shift_register_ >> 3))&1) << 17;
-			noise_shift_register_ >>= 1;
+			step_noise(1);
 		}
 
 		// ... and the envelope generator. Table based for pattern lookup, with a 'refill' step: a way of
@@ -244,6 +330,15 @@ void AY38910::set_port_handler(PortHandler *handler) {
 	port_handler_ = handler;
 }
 
+void AY38910::serialise(State::Archive &archive) {
+	archive.tag("AY38910");
+	archive(selected_register_, registers_, output_registers_, port_inputs_, master_divider_);
+	archive(tone_periods_, tone_counters_, tone_outputs_);
+	archive(noise_period_, noise_counter_, noise_shift_register_, noise_output_);
+	archive(envelope_period_, envelope_divider_, envelope_position_);
+	archive(control_state_, data_input_, data_output_, output_volume_);
+}
+
 void AY38910::set_data_input(uint8_t r) {
 	data_input_ = r;
 	update_bus();
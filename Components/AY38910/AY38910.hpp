@@ -11,6 +11,7 @@
 
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../State/Archive.hpp"
 
 namespace GI {
 namespace AY38910 {
@@ -83,6 +84,12 @@ class AY38910: public ::Outputs::Speaker::SampleSource {
 		*/
 		void set_port_handler(PortHandler *);
 
+		/*!
+			Records or restores the AY's registers, bus state and generator counters. Should be called only
+			while the task queue is idle, i.e. after it has been flushed.
+		*/
+		void serialise(State::Archive &archive);
+
 		// to satisfy ::Outputs::Speaker (included via ::Outputs::Filter; not for public consumption
 		void get_samples(std::size_t number_of_samples, int16_t *target);
 		bool is_zero_level();
@@ -130,6 +137,7 @@ class AY38910: public ::Outputs::Speaker::SampleSource {
 
 		int16_t output_volume_;
 		inline void evaluate_output_volume();
+		inline void step_noise(int steps);
 
 		inline void update_bus();
 		PortHandler *port_handler_ = nullptr;
@@ -36,3 +36,8 @@ void Toggle::set_output(bool enabled) {
 bool Toggle::get_output() {
 	return is_enabled_;
 }
+
+void Toggle::serialise(State::Archive &archive) {
+	archive.tag("AudioToggle");
+	archive(is_enabled_, level_);
+}
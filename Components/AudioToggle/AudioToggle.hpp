@@ -11,6 +11,7 @@
 
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../State/Archive.hpp"
 
 namespace Audio {
 
@@ -28,6 +29,9 @@ class Toggle: public Outputs::Speaker::SampleSource {
 		void set_output(bool enabled);
 		bool get_output();
 
+		/// Records or restores the current output level; should be called only while the audio queue is idle.
+		void serialise(State::Archive &archive);
+
 	private:
 		// Accessed on the calling thread.
 		bool is_enabled_ = false;
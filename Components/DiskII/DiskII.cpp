@@ -8,6 +8,7 @@
 
 #include "DiskII.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 
@@ -93,29 +94,44 @@ uint8_t DiskII::get_shift_register() {
 void DiskII::run_for(const Cycles cycles) {
 	if(is_sleeping()) return;
 
-	int integer_cycles = cycles.as_int();
-
 	if(!controller_can_sleep_) {
-		while(integer_cycles--) {
-			const int address = (state_ & 0xf0) | inputs_ | ((shift_register_&0x80) >> 6);
-			inputs_ |= input_flux;
-			state_ = state_machine_[static_cast<std::size_t>(address)];
-			switch(state_ & 0xf) {
-				case 0x0:	shift_register_ = 0;													break;	// clear
-				case 0x9:	shift_register_ = static_cast<uint8_t>(shift_register_ << 1);			break;	// shift left, bringing in a zero
-				case 0xd:	shift_register_ = static_cast<uint8_t>((shift_register_ << 1) | 1);		break;	// shift left, bringing in a one
-				case 0xb:	shift_register_ = data_register_;										break;	// load
-
-				case 0xa:	// shift right, bringing in write protected status
-					shift_register_ = (shift_register_ >> 1) | (is_write_protected() ? 0x80 : 0x00);
-				break;
-				default: break;
+		// The state machine observes the drives only via the flux input, which is modified only by events
+		// from the active drive. So run the state machine in a tight loop up to the cycle in which the
+		// active drive's next event falls, then advance that drive to the event in a single step. The
+		// inactive drive has no route back into the controller so is advanced in one go afterwards.
+		Storage::Disk::Drive &active_drive = drives_[active_drive_];
+		const bool active_drive_is_sleeping = drive_is_sleeping_[active_drive_];
+		const uint8_t write_protect_bit = is_write_protected() ? 0x80 : 0x00;
+
+		int integer_cycles = cycles.as_int();
+		while(integer_cycles) {
+			int cycles_to_run_for = integer_cycles;
+			if(!active_drive_is_sleeping) {
+				cycles_to_run_for = std::min(cycles_to_run_for, std::max(1, static_cast<int>(active_drive.get_cycles_until_next_event())));
+			}
+			integer_cycles -= cycles_to_run_for;
+
+			for(int c = 0; c < cycles_to_run_for; ++c) {
+				const int address = (state_ & 0xf0) | inputs_ | ((shift_register_&0x80) >> 6);
+				inputs_ |= input_flux;
+				state_ = state_machine_[static_cast<std::size_t>(address)];
+				switch(state_ & 0xf) {
+					case 0x0:	shift_register_ = 0;													break;	// clear
+					case 0x9:	shift_register_ = static_cast<uint8_t>(shift_register_ << 1);			break;	// shift left, bringing in a zero
+					case 0xd:	shift_register_ = static_cast<uint8_t>((shift_register_ << 1) | 1);		break;	// shift left, bringing in a one
+					case 0xb:	shift_register_ = data_register_;										break;	// load
+
+					case 0xa:	// shift right, bringing in write protected status
+						shift_register_ = (shift_register_ >> 1) | write_protect_bit;
+					break;
+					default: break;
+				}
 			}
 
-			// TODO: surely there's a less heavyweight solution than this?
-			if(!drive_is_sleeping_[0]) drives_[0].run_for(Cycles(1));
-			if(!drive_is_sleeping_[1]) drives_[1].run_for(Cycles(1));
+			if(!active_drive_is_sleeping) active_drive.run_for(Cycles(cycles_to_run_for));
 		}
+
+		if(!drive_is_sleeping_[active_drive_^1]) drives_[active_drive_^1].run_for(cycles);
 	} else {
 		if(!drive_is_sleeping_[0]) drives_[0].run_for(cycles);
 		if(!drive_is_sleeping_[1]) drives_[1].run_for(cycles);
@@ -237,6 +253,23 @@ uint8_t DiskII::trigger_address(int address, uint8_t value) {
 	return 0xff;
 }
 
+void DiskII::serialise(State::Archive &archive) {
+	archive.tag("DiskII");
+	archive(state_, inputs_, shift_register_, data_register_, stepper_mask_, stepper_position_, active_drive_);
+	if(active_drive_ & ~1) {
+		archive.invalidate();
+		return;
+	}
+	drives_[0].serialise(archive);
+	drives_[1].serialise(archive);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		select_drive(active_drive_);
+		set_controller_can_sleep();
+		update_sleep_observer();
+	}
+}
+
 void DiskII::set_activity_observer(Activity::Observer *observer) {
 	drives_[0].set_activity_observer(observer, "Drive 1", true);
 	drives_[1].set_activity_observer(observer, "Drive 2", true);
@@ -16,6 +16,7 @@
 #include "../../Storage/Disk/Drive.hpp"
 
 #include "../../Activity/Observer.hpp"
+#include "../../State/Archive.hpp"
 
 #include <array>
 #include <cstdint>
@@ -44,6 +45,9 @@ class DiskII:
 
 		void set_activity_observer(Activity::Observer *observer);
 
+		/// Records or restores the logic state sequencer, stepper and both drives.
+		void serialise(State::Archive &archive);
+
 	private:
 		enum class Control {
 			P0, P1, P2, P3,
@@ -112,4 +112,7 @@ uint8_t SCC::read(uint16_t address) {
 	return 0xff;
 }
 
-
+void SCC::serialise(State::Archive &archive) {
+	archive.tag("KonamiSCC");
+	archive(master_divider_, transient_output_level_, channels_, waves_, channel_enable_, test_register_, ram_);
+}
@@ -11,6 +11,7 @@
 
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../State/Archive.hpp"
 
 namespace Konami {
 
@@ -39,6 +40,9 @@ class SCC: public ::Outputs::Speaker::SampleSource {
 		/// Reads from the SCC.
 		uint8_t read(uint16_t address);
 
+		/// Records or restores the SCC's registers, wave memory and counters; should be called only while the task queue is idle.
+		void serialise(State::Archive &archive);
+
 	private:
 		Concurrency::DeferringAsyncTaskQueue &task_queue_;
 
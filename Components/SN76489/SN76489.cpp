@@ -86,6 +86,11 @@ void SN76489::set_register(uint8_t value) {
 	});
 }
 
+void SN76489::serialise(State::Archive &archive) {
+	archive.tag("SN76489");
+	archive(master_divider_, output_volume_, channels_, noise_mode_, noise_shifter_, active_register_);
+}
+
 bool SN76489::is_zero_level() {
 	return channels_[0].volume == 0xf && channels_[1].volume == 0xf && channels_[2].volume == 0xf && channels_[3].volume == 0xf;
 }
@@ -11,6 +11,7 @@
 
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../State/Archive.hpp"
 
 namespace TI {
 
@@ -28,6 +29,9 @@ class SN76489: public Outputs::Speaker::SampleSource {
 		/// Writes a new value to the SN76489.
 		void set_register(uint8_t value);
 
+		/// Records or restores the SN76489's registers and counters; should be called only while the task queue is idle.
+		void serialise(State::Archive &archive);
+
 		// As per SampleSource.
 		void get_samples(std::size_t number_of_samples, std::int16_t *target);
 		bool is_zero_level();
@@ -0,0 +1,133 @@
+//
+//  AsyncClockedComponent.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef AsyncClockedComponent_hpp
+#define AsyncClockedComponent_hpp
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "../ClockReceiver/ClockReceiver.hpp"
+
+namespace Concurrency {
+
+/*!
+	Runs a clocked component on a thread of its own, trailing behind its owner.
+
+	The owner advances time with @c run_for as usual; time is accumulated and, once a batch of at least
+	@c batch_length cycles is owed, handed to the component's thread to be run while the owner continues.
+	The component never runs ahead of the owner, and the owner may run ahead of the component by at most
+	@c maximum_lag cycles, beyond which @c run_for blocks until the component has caught up.
+
+	The owner must call @c flush before any interaction with the component — including anything that
+	might observe state the component shares with the owner, such as a bus to which both are attached —
+	to bring it exactly up to date. Between calls to @c flush the component must affect the owner only via
+	state that the owner will not inspect until it has flushed, and that nothing else modifies. Any other
+	callbacks the component makes, such as to an Activity::Observer, may occur on the component's thread;
+	the owner should queue them for delivery upon a flush, e.g. via an Activity::QueuedObserver.
+
+	The result is therefore identical to running the component inline, so this may be used with any
+	component that implements run_for(Cycles), whether or not it is also a Sleeper. A @c flush that follows
+	fewer than @c batch_length cycles of activity runs the component on the calling thread, avoiding a
+	thread handoff when the owner interacts with it frequently. On a host with only a single core, the component
+	is always run on the owner's thread.
+*/
+template <typename T> class AsyncClockedComponent {
+	public:
+		AsyncClockedComponent(T &component, Cycles batch_length, Cycles maximum_lag) :
+			component_(component),
+			batch_length_(batch_length),
+			maximum_lag_(maximum_lag.as_int()) {
+			if(std::thread::hardware_concurrency() > 1) {
+				thread_ = std::thread([this] { run_component(); });
+			}
+		}
+
+		~AsyncClockedComponent() {
+			if(!thread_.joinable()) return;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				should_quit_ = true;
+			}
+			work_condition_.notify_all();
+			thread_.join();
+		}
+
+		AsyncClockedComponent(const AsyncClockedComponent &) = delete;
+
+		/// Advances time; this may return before the component has been run, but blocks if it has fallen too far behind.
+		inline void run_for(const Cycles cycles) {
+			cycles_since_handoff_ += cycles;
+			if(cycles_since_handoff_ >= batch_length_) {
+				hand_off(cycles_since_handoff_.flush());
+			}
+		}
+
+		/// Blocks until the component has been run for all time supplied via @c run_for.
+		void flush() {
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				idle_condition_.wait(lock, [this] { return !cycles_owed_ && !cycles_in_progress_; });
+			}
+			if(cycles_since_handoff_ > Cycles(0)) {
+				component_.run_for(cycles_since_handoff_.flush());
+			}
+		}
+
+	private:
+		T &component_;
+		const Cycles batch_length_;
+		const int maximum_lag_;
+
+		// Time supplied by the owner but not yet passed to the component's thread; used only by the owner.
+		Cycles cycles_since_handoff_;
+
+		// Time passed to the component's thread, but not yet started, and the length of the run
+		// currently in progress on that thread; both are guarded by mutex_.
+		int cycles_owed_ = 0;
+		int cycles_in_progress_ = 0;
+		bool should_quit_ = false;
+		std::mutex mutex_;
+		std::condition_variable work_condition_;
+		std::condition_variable idle_condition_;
+
+		std::thread thread_;
+
+		void hand_off(const Cycles cycles) {
+			if(!thread_.joinable()) {
+				component_.run_for(cycles);
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock(mutex_);
+			cycles_owed_ += cycles.as_int();
+			work_condition_.notify_one();
+			idle_condition_.wait(lock, [this] { return cycles_owed_ + cycles_in_progress_ <= maximum_lag_; });
+		}
+
+		void run_component() {
+			std::unique_lock<std::mutex> lock(mutex_);
+			while(true) {
+				work_condition_.wait(lock, [this] { return cycles_owed_ || should_quit_; });
+				if(should_quit_) return;
+
+				const int cycles = cycles_in_progress_ = cycles_owed_;
+				cycles_owed_ = 0;
+				lock.unlock();
+				component_.run_for(Cycles(cycles));
+				lock.lock();
+				cycles_in_progress_ = 0;
+				idle_condition_.notify_all();
+			}
+		}
+};
+
+}
+
+#endif /* AsyncClockedComponent_hpp */
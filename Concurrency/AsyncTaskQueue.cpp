@@ -7,52 +7,23 @@
 //
 
 #include "AsyncTaskQueue.hpp"
+#include "ThreadPool.hpp"
+
+#include <thread>
 
 using namespace Concurrency;
 
-AsyncTaskQueue::AsyncTaskQueue()
-#ifndef __APPLE__
-	: should_destruct_(false)
-#endif
-{
+AsyncTaskQueue::AsyncTaskQueue() {
 #ifdef __APPLE__
 	serial_dispatch_queue_ = dispatch_queue_create("com.thomasharte.clocksignal.asyntaskqueue", DISPATCH_QUEUE_SERIAL);
-#else
-	thread_.reset(new std::thread([this]() {
-		while(!should_destruct_) {
-			std::function<void(void)> next_function;
-
-			// Take lock, check for a new task
-			std::unique_lock<std::mutex> lock(queue_mutex_);
-			if(!pending_tasks_.empty()) {
-				next_function = pending_tasks_.front();
-				pending_tasks_.pop_front();
-			}
-
-			if(next_function) {
-				// If there is a task, release lock and perform it
-				lock.unlock();
-				next_function();
-			} else {
-				// If there isn't a task, atomically block on the processing condition and release the lock
-				// until there's something pending (and then release it again via scope)
-				processing_condition_.wait(lock);
-			}
-		}
-	}));
 #endif
 }
 
 AsyncTaskQueue::~AsyncTaskQueue() {
-#ifdef __APPLE__
 	flush();
+#ifdef __APPLE__
 	dispatch_release(serial_dispatch_queue_);
 	serial_dispatch_queue_ = nullptr;
-#else
-	should_destruct_ = true;
-	enqueue([](){});
-	thread_->join();
-	thread_.reset();
 #endif
 }
 
@@ -62,44 +33,145 @@ void AsyncTaskQueue::enqueue(std::function<void(void)> function) {
 #else
 	std::lock_guard<std::mutex> lock(queue_mutex_);
 	pending_tasks_.push_back(function);
-	processing_condition_.notify_all();
+
+	// If no pool task is currently working through this queue, post one.
+	if(!is_performing_) {
+		is_performing_ = true;
+		ThreadPool::shared().enqueue([this] {
+			perform_pending_tasks();
+		});
+	}
 #endif
 }
 
+#ifndef __APPLE__
+void AsyncTaskQueue::perform_pending_tasks() {
+	while(true) {
+		std::function<void(void)> next_function;
+
+		// Take lock, check for a new task; if there isn't one then this queue is now idle.
+		{
+			std::lock_guard<std::mutex> lock(queue_mutex_);
+			if(pending_tasks_.empty()) {
+				is_performing_ = false;
+				is_idle_condition_.notify_all();
+				return;
+			}
+			next_function = std::move(pending_tasks_.front());
+			pending_tasks_.pop_front();
+		}
+
+		next_function();
+	}
+}
+#endif
+
 void AsyncTaskQueue::flush() {
 #ifdef __APPLE__
 	dispatch_sync(serial_dispatch_queue_, ^{});
 #else
-	std::shared_ptr<std::mutex> flush_mutex(new std::mutex);
-	std::shared_ptr<std::condition_variable> flush_condition(new std::condition_variable);
-	std::unique_lock<std::mutex> lock(*flush_mutex);
-	enqueue([=] () {
-		std::unique_lock<std::mutex> inner_lock(*flush_mutex);
-		flush_condition->notify_all();
-	});
-	flush_condition->wait(lock);
+	std::unique_lock<std::mutex> lock(queue_mutex_);
+	while(is_performing_) {
+		// A pool worker can't simply block, as this queue's work may be waiting
+		// behind this very thread; so help out until the queue is idle.
+		ThreadPool &pool = ThreadPool::shared();
+		if(pool.is_worker_thread()) {
+			lock.unlock();
+			if(!pool.perform_pending_task()) std::this_thread::yield();
+			lock.lock();
+		} else {
+			is_idle_condition_.wait(lock);
+		}
+	}
+#endif
+}
+
+DeferringAsyncTaskQueue::DeferringAsyncTaskQueue(std::size_t capacity) :
+	tasks_(capacity), perform_index_(0), read_index_(0), is_performing_(false) {
+#ifdef __APPLE__
+	serial_dispatch_queue_ = dispatch_queue_create("com.thomasharte.clocksignal.deferringasynctaskqueue", DISPATCH_QUEUE_SERIAL);
 #endif
 }
 
 DeferringAsyncTaskQueue::~DeferringAsyncTaskQueue() {
 	perform();
 	flush();
+#ifdef __APPLE__
+	dispatch_release(serial_dispatch_queue_);
+	serial_dispatch_queue_ = nullptr;
+#endif
 }
 
-void DeferringAsyncTaskQueue::defer(std::function<void(void)> function) {
-	if(!deferred_tasks_) {
-		deferred_tasks_.reset(new std::list<std::function<void(void)>>);
+void DeferringAsyncTaskQueue::perform() {
+	if(perform_index_ == write_index_) return;
+	perform_index_ = write_index_;
+
+	// If nothing is currently working through the tasks, start something that will.
+	if(!is_performing_.exchange(true)) {
+#ifdef __APPLE__
+		dispatch_async_f(serial_dispatch_queue_, this, [] (void *context) {
+			static_cast<DeferringAsyncTaskQueue *>(context)->perform_tasks();
+		});
+#else
+		ThreadPool::shared().enqueue([this] {
+			perform_tasks();
+		});
+#endif
 	}
-	deferred_tasks_->push_back(function);
 }
 
-void DeferringAsyncTaskQueue::perform() {
-	if(!deferred_tasks_) return;
-	std::shared_ptr<std::list<std::function<void(void)>>> deferred_tasks = deferred_tasks_;
-	deferred_tasks_.reset();
-	enqueue([deferred_tasks] {
-		for(const auto &function : *deferred_tasks) {
-			function();
+void DeferringAsyncTaskQueue::perform_tasks() {
+	const std::size_t mask = tasks_.size() - 1;
+	std::size_t read_index = read_index_.load(std::memory_order_relaxed);
+
+	while(true) {
+		const std::size_t perform_index = perform_index_;
+		while(read_index != perform_index) {
+			Task &task = tasks_[read_index & mask];
+			task();
+			task.reset();
+
+			++read_index;
+			read_index_.store(read_index, std::memory_order_release);
+		}
+
+		// Go idle, unless perform was called between the check above and doing so.
+		std::lock_guard<std::mutex> lock(idle_mutex_);
+		is_performing_ = false;
+		if(perform_index_ != read_index && !is_performing_.exchange(true)) continue;
+
+		idle_condition_.notify_all();
+		return;
+	}
+}
+
+void DeferringAsyncTaskQueue::flush() {
+#ifndef __APPLE__
+	// A pool worker can't simply block, as the tasks may be waiting behind this very thread.
+	ThreadPool &pool = ThreadPool::shared();
+	if(pool.is_worker_thread()) {
+		while(true) {
+			{
+				std::lock_guard<std::mutex> lock(idle_mutex_);
+				if(!is_performing_) return;
+			}
+			if(!pool.perform_pending_task()) std::this_thread::yield();
 		}
-	});
+	}
+#endif
+
+	std::unique_lock<std::mutex> lock(idle_mutex_);
+	idle_condition_.wait(lock, [this] { return !is_performing_; });
+}
+
+void DeferringAsyncTaskQueue::wait_for_space() {
+	// Make sure that everything already deferred is on its way, then wait for the oldest to be performed.
+	perform();
+	while(write_index_ - read_index_.load(std::memory_order_acquire) == tasks_.size()) {
+#ifndef __APPLE__
+		ThreadPool &pool = ThreadPool::shared();
+		if(pool.is_worker_thread() && pool.perform_pending_task()) continue;
+#endif
+		std::this_thread::yield();
+	}
 }
@@ -9,12 +9,15 @@
 #ifndef AsyncTaskQueue_hpp
 #define AsyncTaskQueue_hpp
 
+#include "Task.hpp"
+
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <list>
-#include <memory>
-#include <thread>
+#include <mutex>
+#include <vector>
 
 #ifdef __APPLE__
 #include <dispatch/dispatch.h>
@@ -26,6 +29,8 @@ namespace Concurrency {
 	An async task queue allows a caller to enqueue void(void) functions. Those functions are guaranteed
 	to be performed serially and asynchronously from the caller. A caller may also request to flush,
 	causing it to block until all previously-enqueued functions are complete.
+
+	Queues do not own threads; functions are performed by the shared ThreadPool, or by libdispatch on Apple platforms.
 */
 class AsyncTaskQueue {
 	public:
@@ -50,25 +55,33 @@ class AsyncTaskQueue {
 #ifdef __APPLE__
 		dispatch_queue_t serial_dispatch_queue_;
 #else
-		std::unique_ptr<std::thread> thread_;
-
 		std::mutex queue_mutex_;
 		std::list<std::function<void(void)>> pending_tasks_;
-		std::condition_variable processing_condition_;
-		std::atomic_bool should_destruct_;
+
+		// Indicates whether a call to perform_pending_tasks has been enqueued with the thread pool
+		// and not yet run out of work; is_idle_condition_ is signalled when it does.
+		bool is_performing_ = false;
+		std::condition_variable is_idle_condition_;
+
+		void perform_pending_tasks();
 #endif
 };
 
 /*!
 	A deferring async task queue is one that accepts a list of functions to be performed but defers
-	any action until told to perform. It performs them by enquing a single asynchronous task that will
-	perform the deferred tasks in order.
+	any action until told to perform. It then performs the deferred functions asynchronously, in order.
 
 	It therefore offers similar semantics to an asynchronous task queue, but allows for management of
 	synchronisation costs, since neither defer nor perform make any effort to be thread safe.
+
+	Deferred functions are held as Tasks in a fixed-size ring buffer that is shared, without locking,
+	with whichever thread performs them; deferring and performing therefore don't allocate. If the ring
+	is full then defer will block until space is available.
 */
-class DeferringAsyncTaskQueue: public AsyncTaskQueue {
+class DeferringAsyncTaskQueue {
 	public:
+		/// Constructs a queue that can hold up to @c capacity deferred or unperformed functions; @c capacity must be a power of two.
+		DeferringAsyncTaskQueue(std::size_t capacity = 2048);
 		~DeferringAsyncTaskQueue();
 
 		/*!
@@ -76,20 +89,48 @@ class DeferringAsyncTaskQueue: public AsyncTaskQueue {
 
 			This is not thread safe; it should be serialised with other calls to itself and to perform.
 		*/
-		void defer(std::function<void(void)> function);
+		template <typename Function> void defer(Function &&function) {
+			if(write_index_ - read_index_.load(std::memory_order_acquire) == tasks_.size()) {
+				wait_for_space();
+			}
+			tasks_[write_index_ & (tasks_.size() - 1)] = Task(std::forward<Function>(function));
+			++write_index_;
+		}
 
 		/*!
-			Enqueues a function that will perform all currently deferred functions, in the
-			order that they were deferred.
+			Schedules all currently deferred functions to be performed, in the order that they were deferred.
 
 			This is not thread safe; it should be serialised with other calls to itself and to defer.
 		*/
 		void perform();
 
+		/*!
+			Blocks the caller until all functions scheduled by previous calls to perform have completed.
+		*/
+		void flush();
+
 	private:
-		// TODO: this is a shared_ptr because of the issues capturing moveables in C++11;
-		// switch to a unique_ptr if/when adapting to C++14
-		std::shared_ptr<std::list<std::function<void(void)>>> deferred_tasks_;
+		std::vector<Task> tasks_;
+
+		// write_index_ is the index of the next task to be deferred, and is used only by the deferring thread;
+		// perform_index_ is the index one beyond the most recent task to be performed; and read_index_ is the
+		// index of the next task to be performed, and is written only by the performing thread.
+		std::size_t write_index_ = 0;
+		std::atomic<std::size_t> perform_index_;
+		std::atomic<std::size_t> read_index_;
+
+		// Indicates whether tasks are currently being performed. This is set by perform and cleared by the
+		// performing thread upon running out of tasks, while holding idle_mutex_ so that flush can't miss it.
+		std::atomic_bool is_performing_;
+		std::mutex idle_mutex_;
+		std::condition_variable idle_condition_;
+
+#ifdef __APPLE__
+		dispatch_queue_t serial_dispatch_queue_;
+#endif
+
+		void perform_tasks();
+		void wait_for_space();
 };
 
 }
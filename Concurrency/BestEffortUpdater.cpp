@@ -8,11 +8,30 @@
 
 #include "BestEffortUpdater.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace Concurrency;
 
-BestEffortUpdater::BestEffortUpdater() {
+namespace {
+
+/// The longest single period that the delegate will be asked to run for in turbo mode; this keeps
+/// overshoot of the multiplier cap and of the real-time budget small.
+constexpr double TurboSliceLength = 0.01;
+
+/// The most real time that a single turbo update will occupy, to keep the queue responsive to
+/// flushes and to changes in mode.
+constexpr double MaximumTurboBudget = 0.1;
+
+}
+
+BestEffortUpdater::BestEffortUpdater() :
+	is_turbo_(false),
+	maximum_multiplier_(0.0),
+	speed_multiplier_(1.0),
+	turbo_audio_(TurboAudio::Drop),
+	turbo_frame_interval_(1.0 / 25.0) {
 	// ATOMIC_FLAG_INIT isn't necessarily safe to use, so establish default state by other means.
 	update_is_ongoing_.clear();
 }
@@ -40,7 +59,12 @@ void BestEffortUpdater::update() {
 				if(integer_duration > 0) {
 					if(delegate_) {
 						const double duration = static_cast<double>(integer_duration) / 1e9;
-						delegate_->update(this, duration, has_skipped_);
+						if(is_turbo_) {
+							run_turbo(std::min(duration, MaximumTurboBudget));
+						} else {
+							delegate_->update(this, duration, has_skipped_);
+							speed_multiplier_ = 1.0;
+						}
 					}
 					has_skipped_ = false;
 				}
@@ -68,3 +92,78 @@ void BestEffortUpdater::set_delegate(Delegate *const delegate) {
 	});
 }
 
+void BestEffortUpdater::run_turbo(Time::Seconds budget) {
+	// Occupy the same amount of real time as has elapsed since the previous update, running the delegate
+	// in short slices until either that time is exhausted or the multiplier cap is reached. Since the
+	// next update will then measure this period, the two together keep the queue continuously busy.
+	const double maximum_multiplier = maximum_multiplier_;
+	const double emulated_limit = (maximum_multiplier > 0.0) ? budget * maximum_multiplier : std::numeric_limits<double>::max();
+	const auto deadline = std::chrono::high_resolution_clock::now() + std::chrono::nanoseconds(static_cast<int64_t>(budget * 1e9));
+
+	double emulated = 0.0;
+	bool did_skip_previous_update = has_skipped_;
+	do {
+		const double slice = std::min(TurboSliceLength, emulated_limit - emulated);
+		delegate_->update(this, slice, did_skip_previous_update);
+		did_skip_previous_update = false;
+		emulated += slice;
+	} while(emulated < emulated_limit && std::chrono::high_resolution_clock::now() < deadline);
+
+	speed_multiplier_ = emulated / budget;
+}
+
+void BestEffortUpdater::set_turbo(bool enabled, double maximum_multiplier) {
+	maximum_multiplier_ = maximum_multiplier;
+	is_turbo_ = enabled;
+}
+
+bool BestEffortUpdater::get_is_turbo() const {
+	return is_turbo_;
+}
+
+void BestEffortUpdater::set_turbo_audio(TurboAudio turbo_audio) {
+	turbo_audio_ = turbo_audio;
+}
+
+void BestEffortUpdater::set_turbo_frame_rate(double frames_per_second) {
+	turbo_frame_interval_ = 1.0 / frames_per_second;
+}
+
+double BestEffortUpdater::get_speed_multiplier() const {
+	return speed_multiplier_;
+}
+
+bool BestEffortUpdater::should_output_audio_buffer() {
+	if(!is_turbo_) {
+		audio_accumulator_ = 0.0;
+		return true;
+	}
+
+	switch(turbo_audio_.load()) {
+		case TurboAudio::Drop: return false;
+
+		case TurboAudio::Stretch: {
+			// Keep one buffer in every speed_multiplier_, on average.
+			audio_accumulator_ += 1.0;
+			const double speed_multiplier = std::max(1.0, speed_multiplier_.load());
+			if(audio_accumulator_ >= speed_multiplier) {
+				audio_accumulator_ -= speed_multiplier;
+				return true;
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool BestEffortUpdater::should_draw_frame() {
+	const auto now = std::chrono::high_resolution_clock::now();
+	if(is_turbo_) {
+		const double since_previous_frame = std::chrono::duration_cast<std::chrono::duration<double>>(now - previous_frame_time_point_).count();
+		if(since_previous_frame < turbo_frame_interval_) return false;
+	}
+
+	previous_frame_time_point_ = now;
+	return true;
+}
@@ -23,6 +23,11 @@ namespace Concurrency {
 	backlog of calls accrues.
 
 	No guarantees about the thread that the delegate will be called on are made.
+
+	The updater can alternatively be put into turbo mode, in which emulated time is run as quickly as
+	the host is able, optionally subject to a cap on the ratio of emulated to real time. In that mode
+	the delegate will receive a sequence of short updates in place of each real-time one, and hosts
+	can consult the updater to decide which audio buffers to output and which frames to draw.
 */
 class BestEffortUpdater {
 	public:
@@ -46,6 +51,50 @@ class BestEffortUpdater {
 		/// Blocks until any ongoing update is complete.
 		void flush();
 
+		/// Describes what should happen to audio while running in turbo mode.
+		enum class TurboAudio {
+			/// All audio is discarded.
+			Drop,
+			/// Complete buffers are retained in proportion to the current speed, so that audio
+			/// continues at its original pitch but with the intervening sections skipped.
+			Stretch
+		};
+
+		/*!
+			Enables or disables turbo mode. Changes take effect from the next update.
+
+			@param enabled @c true to run as quickly as possible; @c false to return to real-time pacing.
+			@param maximum_multiplier If positive, the maximum ratio of emulated to real time; otherwise
+				emulated time is uncapped.
+		*/
+		void set_turbo(bool enabled, double maximum_multiplier = 0.0);
+
+		/// @returns @c true if turbo mode is currently enabled; @c false otherwise.
+		bool get_is_turbo() const;
+
+		/// Sets the treatment of audio while in turbo mode; the default is to drop it.
+		void set_turbo_audio(TurboAudio turbo_audio);
+
+		/// Sets the maximum number of frames per second of real time that should be drawn while in turbo mode.
+		void set_turbo_frame_rate(double frames_per_second);
+
+		/// @returns The ratio of emulated to real time over the most recent update; this is always 1.0 outside of turbo mode.
+		double get_speed_multiplier() const;
+
+		/*!
+			Intended to be called by the host upon receipt of each buffer of audio.
+
+			@returns @c true if the buffer should be output; @c false if it should be discarded.
+		*/
+		bool should_output_audio_buffer();
+
+		/*!
+			Intended to be called by the host before each opportunity to draw a frame.
+
+			@returns @c true if the frame should be drawn; @c false if it should be skipped.
+		*/
+		bool should_draw_frame();
+
 	private:
 		std::atomic_flag update_is_ongoing_;
 		AsyncTaskQueue async_task_queue_;
@@ -55,6 +104,19 @@ class BestEffortUpdater {
 		bool has_skipped_ = false;
 
 		Delegate *delegate_ = nullptr;
+
+		std::atomic<bool> is_turbo_;
+		std::atomic<double> maximum_multiplier_;
+		std::atomic<double> speed_multiplier_;
+		void run_turbo(Time::Seconds budget);
+
+		// Owned by whichever thread is outputting audio.
+		std::atomic<TurboAudio> turbo_audio_;
+		double audio_accumulator_ = 0.0;
+
+		// Owned by whichever thread is drawing.
+		std::atomic<double> turbo_frame_interval_;
+		std::chrono::time_point<std::chrono::high_resolution_clock> previous_frame_time_point_;
 };
 
 }
@@ -0,0 +1,100 @@
+//
+//  Task.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef Concurrency_Task_hpp
+#define Concurrency_Task_hpp
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Concurrency {
+
+/*!
+	A Task holds a void(void) callable, much like std::function<void(void)>, but stores it inline
+	and therefore never allocates. Callables larger than @c Task::StorageSize are rejected at compile time.
+
+	Tasks are move-only.
+*/
+class Task {
+	public:
+		enum {
+			/// The largest callable, in bytes, that a Task can hold; sufficient for a lambda capturing six pointers.
+			StorageSize = 6 * sizeof(void *)
+		};
+
+		Task() {}
+
+		template <typename Function, typename = typename std::enable_if<!std::is_same<typename std::decay<Function>::type, Task>::value>::type>
+			Task(Function &&function) {
+			typedef typename std::decay<Function>::type Stored;
+			static_assert(sizeof(Stored) <= sizeof(storage_), "Callable is too large to store in a Task");
+			static_assert(alignof(Stored) <= alignof(Storage), "Callable is too strictly aligned to store in a Task");
+
+			new (&storage_) Stored(std::forward<Function>(function));
+			perform_ = [] (void *storage) {
+				(*static_cast<Stored *>(storage))();
+			};
+			relocate_ = [] (void *destination, void *source) {
+				if(destination) new (destination) Stored(std::move(*static_cast<Stored *>(source)));
+				static_cast<Stored *>(source)->~Stored();
+			};
+		}
+
+		Task(Task &&rhs) {
+			*this = std::move(rhs);
+		}
+
+		Task &operator =(Task &&rhs) {
+			if(this == &rhs) return *this;
+			reset();
+			if(rhs.perform_) {
+				rhs.relocate_(&storage_, &rhs.storage_);
+				perform_ = rhs.perform_;
+				relocate_ = rhs.relocate_;
+				rhs.perform_ = nullptr;
+				rhs.relocate_ = nullptr;
+			}
+			return *this;
+		}
+
+		Task(const Task &) = delete;
+		Task &operator =(const Task &) = delete;
+
+		~Task() {
+			reset();
+		}
+
+		/// Performs the stored callable, which must exist.
+		void operator()() {
+			perform_(&storage_);
+		}
+
+		/// @returns @c true if this task holds a callable; @c false otherwise.
+		explicit operator bool() const {
+			return perform_ != nullptr;
+		}
+
+		/// Destroys the stored callable, if any.
+		void reset() {
+			if(relocate_) relocate_(nullptr, &storage_);
+			perform_ = nullptr;
+			relocate_ = nullptr;
+		}
+
+	private:
+		typedef typename std::aligned_storage<StorageSize, alignof(std::max_align_t)>::type Storage;
+		Storage storage_;
+		void (*perform_)(void *) = nullptr;
+		void (*relocate_)(void *, void *) = nullptr;
+};
+
+}
+
+#endif /* Concurrency_Task_hpp */
@@ -0,0 +1,190 @@
+//
+//  ThreadPool.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+using namespace Concurrency;
+
+namespace {
+
+// The pool and index of the worker running on the current thread, if any.
+thread_local ThreadPool *current_pool = nullptr;
+thread_local std::size_t current_worker = 0;
+
+}
+
+ThreadPool::ThreadPool(std::size_t number_of_threads) :
+	pending_tasks_(0), next_worker_(0), should_finish_(false) {
+	if(!number_of_threads) number_of_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	for(std::size_t c = 0; c < number_of_threads; ++c) {
+		workers_.emplace_back(new Worker);
+	}
+
+	for(std::size_t c = 0; c < number_of_threads; ++c) {
+		threads_.emplace_back([this, c]() {
+			current_pool = this;
+			current_worker = c;
+
+			while(true) {
+				std::function<void(void)> task;
+				if(take_task(c, task)) {
+					task();
+					continue;
+				}
+
+				// Sleep until there's something to do; pending_tasks_ is incremented before any
+				// notification is posted, so checking it under the lock can't miss a task.
+				std::unique_lock<std::mutex> lock(sleep_mutex_);
+				sleep_condition_.wait(lock, [this] { return pending_tasks_ || should_finish_; });
+				if(should_finish_ && !pending_tasks_) return;
+			}
+		});
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex_);
+		should_finish_ = true;
+		sleep_condition_.notify_all();
+	}
+	for(auto &thread: threads_) {
+		thread.join();
+	}
+}
+
+ThreadPool &ThreadPool::shared() {
+	// This is deliberately leaked so that it remains available to the destructors of other static objects.
+	static ThreadPool *const pool = new ThreadPool;
+	return *pool;
+}
+
+std::size_t ThreadPool::size() const {
+	return workers_.size();
+}
+
+bool ThreadPool::is_worker_thread() const {
+	return current_pool == this;
+}
+
+void ThreadPool::enqueue(std::function<void(void)> task) {
+	// Workers keep their own tasks; anybody else distributes tasks in turn.
+	const std::size_t worker = is_worker_thread() ? current_worker : (next_worker_++ % workers_.size());
+	{
+		std::lock_guard<std::mutex> lock(workers_[worker]->mutex);
+		workers_[worker]->push_back(std::move(task));
+	}
+	++pending_tasks_;
+
+	std::lock_guard<std::mutex> lock(sleep_mutex_);
+	sleep_condition_.notify_one();
+}
+
+bool ThreadPool::take_task(std::size_t worker, std::function<void(void)> &task) {
+	if(!pending_tasks_) return false;
+
+	// Take the most recent of this worker's own tasks, if any.
+	{
+		Worker &self = *workers_[worker];
+		std::lock_guard<std::mutex> lock(self.mutex);
+		if(self.count) {
+			task = self.pop_back();
+			--pending_tasks_;
+			return true;
+		}
+	}
+
+	// Otherwise steal the oldest of somebody else's.
+	for(std::size_t offset = 1; offset < workers_.size(); ++offset) {
+		Worker &victim = *workers_[(worker + offset) % workers_.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if(victim.count) {
+			task = victim.pop_front();
+			--pending_tasks_;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::Worker::push_back(std::function<void(void)> &&task) {
+	if(count == tasks.size()) {
+		std::vector<std::function<void(void)>> new_tasks(std::max(tasks.size() * 2, std::size_t(16)));
+		for(std::size_t c = 0; c < count; ++c) {
+			new_tasks[c] = std::move(tasks[(first + c) % tasks.size()]);
+		}
+		tasks = std::move(new_tasks);
+		first = 0;
+	}
+	tasks[(first + count) % tasks.size()] = std::move(task);
+	++count;
+}
+
+std::function<void(void)> ThreadPool::Worker::pop_back() {
+	--count;
+	return std::move(tasks[(first + count) % tasks.size()]);
+}
+
+std::function<void(void)> ThreadPool::Worker::pop_front() {
+	std::function<void(void)> task = std::move(tasks[first]);
+	first = (first + 1) % tasks.size();
+	--count;
+	return task;
+}
+
+bool ThreadPool::perform_pending_task() {
+	std::function<void(void)> task;
+	if(!take_task(is_worker_thread() ? current_worker : 0, task)) return false;
+	task();
+	return true;
+}
+
+void ThreadPool::parallel_for(std::size_t count, const std::function<void(std::size_t)> &function) {
+	if(!count) return;
+
+	// State is shared with the helper tasks, some of which may not begin until after all indices
+	// have been claimed and this call has returned; such helpers will find nothing to do.
+	struct State {
+		std::atomic<std::size_t> next_index;
+		std::atomic<std::size_t> completed;
+		std::size_t count;
+		const std::function<void(std::size_t)> *function;
+		std::mutex mutex;
+		std::condition_variable condition;
+	};
+	std::shared_ptr<State> state(new State);
+	state->next_index = 0;
+	state->completed = 0;
+	state->count = count;
+	state->function = &function;
+
+	const auto perform = [state]() {
+		std::size_t index;
+		while((index = state->next_index++) < state->count) {
+			(*state->function)(index);
+			if(++state->completed == state->count) {
+				std::lock_guard<std::mutex> lock(state->mutex);
+				state->condition.notify_all();
+			}
+		}
+	};
+
+	// Enlist as many workers as could usefully help, and help.
+	const std::size_t helpers = std::min(count - 1, workers_.size());
+	for(std::size_t c = 0; c < helpers; ++c) {
+		enqueue(perform);
+	}
+	perform();
+
+	std::unique_lock<std::mutex> lock(state->mutex);
+	state->condition.wait(lock, [&state] { return state->completed == state->count; });
+}
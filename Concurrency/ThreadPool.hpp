@@ -0,0 +1,93 @@
+//
+//  ThreadPool.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef ThreadPool_hpp
+#define ThreadPool_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Concurrency {
+
+/*!
+	A thread pool owns a fixed number of worker threads, each with its own list of pending tasks.
+	Tasks enqueued by a worker are added to its own list; others are distributed between workers.
+	A worker with nothing to do takes the oldest task from another's list.
+
+	Tasks may be performed in any order and on any worker; use an AsyncTaskQueue where order matters.
+*/
+class ThreadPool {
+	public:
+		/// Constructs a pool with @c number_of_threads workers; if that is zero then one worker is created per host core.
+		ThreadPool(std::size_t number_of_threads = 0);
+		~ThreadPool();
+
+		/// @returns The pool shared by all parts of the emulator, which has one worker per host core and is never destroyed.
+		static ThreadPool &shared();
+
+		/// @returns The number of worker threads.
+		std::size_t size() const;
+
+		/*!
+			Adds @c task to the pool, to be performed asynchronously. This method is safe to call from any thread.
+		*/
+		void enqueue(std::function<void(void)> task);
+
+		/*!
+			Calls @c function once for every index from 0 to @c count - 1, in parallel, returning only once
+			all calls have completed. The calling thread performs some of the calls itself, so it is safe to use
+			this from within a task.
+		*/
+		void parallel_for(std::size_t count, const std::function<void(std::size_t)> &function);
+
+		/// @returns @c true if the calling thread is one of this pool's workers; @c false otherwise.
+		bool is_worker_thread() const;
+
+		/*!
+			Performs a single pending task on the calling thread, if there is one. Intended for use by
+			workers that would otherwise block waiting for work enqueued to this pool.
+
+			@returns @c true if a task was performed; @c false otherwise.
+		*/
+		bool perform_pending_task();
+
+	private:
+		struct Worker {
+			std::mutex mutex;
+
+			// A ring buffer of tasks that grows as required but never shrinks, so
+			// that enqueuing doesn't allocate once a steady state has been reached.
+			std::vector<std::function<void(void)>> tasks;
+			std::size_t first = 0, count = 0;
+
+			void push_back(std::function<void(void)> &&task);
+			std::function<void(void)> pop_back();
+			std::function<void(void)> pop_front();
+		};
+		std::vector<std::unique_ptr<Worker>> workers_;
+		std::vector<std::thread> threads_;
+
+		std::atomic<std::size_t> pending_tasks_;
+		std::atomic<std::size_t> next_worker_;
+		std::atomic_bool should_finish_;
+
+		std::mutex sleep_mutex_;
+		std::condition_variable sleep_condition_;
+
+		bool take_task(std::size_t worker, std::function<void(void)> &task);
+};
+
+}
+
+#endif /* ThreadPool_hpp */
@@ -17,6 +17,7 @@
 #include "../../Components/8272/i8272.hpp"
 #include "../../Components/AY38910/AY38910.hpp"
 
+#include "../Utility/CopyOnWritePages.hpp"
 #include "../Utility/MemoryFuzzer.hpp"
 #include "../Utility/Typer.hpp"
 
@@ -24,19 +25,27 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../Storage/Tape/Tape.hpp"
+#include "../../Storage/Tape/Parsers/AmstradCPC.hpp"
 
+#include "../../Configurable/StandardOptions.hpp"
 #include "../../ClockReceiver/ForceInline.hpp"
 #include "../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
 
 #include "../../Analyser/Static/AmstradCPC/Target.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace AmstradCPC {
 
+std::vector<std::unique_ptr<Configurable::Option>> get_options() {
+	return Configurable::standard_options(Configurable::QuickLoadTape);
+}
+
 enum ROMType: int {
 	OS464 = 0,	BASIC464,
 	OS664,		BASIC664,
@@ -108,6 +117,11 @@ class InterruptTimer {
 			interrupt_request_ = false;
 		}
 
+		/// Records or restores the counter and request state.
+		void serialise(State::Archive &archive) {
+			archive(reset_counter_, interrupt_request_, last_interrupt_request_, timer_);
+		}
+
 	private:
 		int reset_counter_ = 0;
 		bool interrupt_request_ = false;
@@ -156,6 +170,15 @@ class AYDeferrer {
 			return ay_;
 		}
 
+		/// Brings the AY up to date and records or restores its state, plus any time not yet applied to it.
+		void serialise(State::Archive &archive) {
+			update();
+			flush();
+			audio_queue_.flush();
+			ay_.serialise(archive);
+			archive(cycles_since_update_);
+		}
+
 	private:
 		Concurrency::DeferringAsyncTaskQueue audio_queue_;
 		GI::AY38910::AY38910 ay_;
@@ -170,8 +193,8 @@ class AYDeferrer {
 */
 class CRTCBusHandler {
 	public:
-		CRTCBusHandler(uint8_t *ram, InterruptTimer &interrupt_timer) :
-			ram_(ram),
+		CRTCBusHandler(uint8_t *const *ram_pages, InterruptTimer &interrupt_timer) :
+			ram_pages_(ram_pages),
 			interrupt_timer_(interrupt_timer) {
 				establish_palette_hits();
 				build_mode_table();
@@ -235,30 +258,31 @@ class CRTCBusHandler {
 							((state.row_address & 0x7) << 11) |
 							((state.refresh_address & 0x3000) << 2)
 						);
+					const uint8_t *const ram = &ram_pages_[address >> 14][address & 16383];
 
 					// fetch two bytes and translate into pixels
 					switch(mode_) {
 						case 0:
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode0_output_[ram_[address]];
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode0_output_[ram_[address+1]];
+							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode0_output_[ram[0]];
+							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode0_output_[ram[1]];
 							pixel_pointer_ += 4;
 						break;
 
 						case 1:
-							reinterpret_cast<uint32_t *>(pixel_pointer_)[0] = mode1_output_[ram_[address]];
-							reinterpret_cast<uint32_t *>(pixel_pointer_)[1] = mode1_output_[ram_[address+1]];
+							reinterpret_cast<uint32_t *>(pixel_pointer_)[0] = mode1_output_[ram[0]];
+							reinterpret_cast<uint32_t *>(pixel_pointer_)[1] = mode1_output_[ram[1]];
 							pixel_pointer_ += 8;
 						break;
 
 						case 2:
-							reinterpret_cast<uint64_t *>(pixel_pointer_)[0] = mode2_output_[ram_[address]];
-							reinterpret_cast<uint64_t *>(pixel_pointer_)[1] = mode2_output_[ram_[address+1]];
+							reinterpret_cast<uint64_t *>(pixel_pointer_)[0] = mode2_output_[ram[0]];
+							reinterpret_cast<uint64_t *>(pixel_pointer_)[1] = mode2_output_[ram[1]];
 							pixel_pointer_ += 16;
 						break;
 
 						case 3:
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode3_output_[ram_[address]];
-							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode3_output_[ram_[address+1]];
+							reinterpret_cast<uint16_t *>(pixel_pointer_)[0] = mode3_output_[ram[0]];
+							reinterpret_cast<uint16_t *>(pixel_pointer_)[1] = mode3_output_[ram[1]];
 							pixel_pointer_ += 4;
 						break;
 
@@ -309,14 +333,21 @@ class CRTCBusHandler {
 		}
 
 		/// Constructs an appropriate CRT for video output.
-		void setup_output(float aspect_ratio) {
-			crt_.reset(new Outputs::CRT::CRT(1024, 16, Outputs::CRT::DisplayType::PAL50, 1));
+		void setup_output(float aspect_ratio, Outputs::CRT::OutputBackend backend) {
+			crt_.reset(new Outputs::CRT::CRT(1024, 16, Outputs::CRT::DisplayType::PAL50, 1, backend));
 			crt_->set_rgb_sampling_function(
 				"vec3 rgb_sample(usampler2D sampler, vec2 coordinate, vec2 icoordinate)"
 				"{"
 					"uint sample = texture(texID, coordinate).r;"
 					"return vec3(float((sample >> 4) & 3u), float((sample >> 2) & 3u), float(sample & 3u)) / 2.0;"
 				"}");
+			crt_->set_software_sampling_function([] (const uint8_t *sample, unsigned int) -> uint32_t {
+				const uint8_t levels[] = {0x00, 0x80, 0xff, 0xff};
+				return
+					static_cast<uint32_t>(levels[(sample[0] >> 4) & 3] << 16) |
+					static_cast<uint32_t>(levels[(sample[0] >> 2) & 3] << 8) |
+					static_cast<uint32_t>(levels[sample[0] & 3]);
+			});
 			crt_->set_visible_area(Outputs::CRT::Rect(0.075f, 0.05f, 0.9f, 0.9f));
 			crt_->set_video_signal(Outputs::CRT::VideoSignal::RGB);
 		}
@@ -360,6 +391,25 @@ class CRTCBusHandler {
 			}
 		}
 
+		/*!
+			Records or restores the gate array's palette, mode and sync tracking. Any partial pixel
+			run in progress upon restoration continues into a fresh write area.
+		*/
+		void serialise(State::Archive &archive) {
+			archive.tag("GateArray");
+			archive(cycles_, was_enabled_, was_sync_, was_hsync_, was_vsync_, cycles_into_hsync_);
+			archive(next_mode_, mode_, pixel_divider_, pen_, palette_, border_);
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				if(mode_ & ~3 || next_mode_ & ~3 || pen_ & ~31 || !pixel_divider_) {
+					archive.invalidate();
+					return;
+				}
+				pixel_pointer_ = pixel_data_ = nullptr;
+				build_mode_table();
+			}
+		}
+
 	private:
 		void output_border(unsigned int length) {
 			uint8_t *colour_pointer = static_cast<uint8_t *>(crt_->allocate_write_area(1));
@@ -514,7 +564,7 @@ class CRTCBusHandler {
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
 		uint8_t *pixel_data_ = nullptr, *pixel_pointer_ = nullptr;
 
-		uint8_t *ram_ = nullptr;
+		uint8_t *const *ram_pages_ = nullptr;
 
 		int next_mode_ = 2, mode_ = 2;
 
@@ -576,6 +626,11 @@ class KeyboardState: public GI::AY38910::PortHandler {
 			memset(rows_, 0xff, 10);
 		}
 
+		/// Records or restores the selected row.
+		void serialise(State::Archive &archive) {
+			archive(row_);
+		}
+
 	private:
 		uint8_t rows_[10];
 		int row_;
@@ -609,9 +664,18 @@ class FDC: public Intel::i8272::i8272 {
 			drive_->set_disk(disk);
 		}
 
+		std::shared_ptr<Storage::Disk::Disk> get_disk(int drive) {
+			return drive_->get_disk();
+		}
+
 		void set_activity_observer(Activity::Observer *observer) {
 			drive_->set_activity_observer(observer, "Drive 1", true);
 		}
+
+		void serialise(State::Archive &archive) {
+			i8272::serialise(archive);
+			drive_->serialise(archive);
+		}
 };
 
 /*!
@@ -691,16 +755,24 @@ class i8255PortHandler : public Intel::i8255::PortHandler {
 class ConcreteMachine:
 	public CRTMachine::Machine,
 	public ConfigurationTarget::Machine,
+	public Configurable::Device,
 	public KeyboardMachine::Machine,
 	public Utility::TypeRecipient,
 	public CPU::Z80::BusHandler,
 	public Sleeper::SleepObserver,
 	public Machine,
-	public Activity::Source {
+	public Activity::Source,
+	public SnapshotMachine::Machine {
 	public:
-		ConcreteMachine() :
+		ConcreteMachine() : ConcreteMachine(nullptr) {}
+
+		/*!
+			Constructs a machine that shares its RAM and ROMs with @c parent if one is supplied; otherwise
+			the machine is given RAM of its own, in a random state, and awaits its ROMs.
+		*/
+		explicit ConcreteMachine(ConcreteMachine *parent) :
 			z80_(*this),
-			crtc_bus_handler_(ram_, interrupt_timer_),
+			crtc_bus_handler_(ram_pages_, interrupt_timer_),
 			crtc_(Motorola::CRTC::HD6845S, crtc_bus_handler_),
 			i8255_port_handler_(key_state_, crtc_, ay_, tape_player_),
 			i8255_(i8255_port_handler_),
@@ -710,8 +782,23 @@ class ConcreteMachine:
 			// primary clock is 4Mhz
 			set_clock_rate(4000000);
 
-			// ensure memory starts in a random state
-			Memory::Fuzz(ram_, sizeof(ram_));
+			if(parent) {
+				// Share all RAM, which leaves the parent's write pointers to be reestablished
+				// as and when it next writes; nothing is allocated or copied here.
+				rom_model_ = parent->rom_model_;
+				has_fdc_ = parent->has_fdc_;
+				has_128k_ = parent->has_128k_;
+				for(int c = 0; c < 7; ++c) roms_[c] = parent->roms_[c];
+				parent->ram_.share_with(ram_);
+				parent->update_paging();
+			} else {
+				// ensure memory starts in a random state
+				ram_ = Memory::CopyOnWritePages<16384>(8);
+				for(std::size_t c = 0; c < ram_.size(); ++c) {
+					Memory::Fuzz(ram_.page(c), 16384);
+				}
+			}
+			update_paging();
 
 			// register this class as the sleep observer for the FDC and tape
 			fdc_.set_sleep_observer(this);
@@ -760,12 +847,19 @@ class ConcreteMachine:
 			uint16_t address = cycle.address ? *cycle.address : 0x0000;
 			switch(cycle.operation) {
 				case CPU::Z80::PartialMachineCycle::ReadOpcode:
+					// If this is the start of the firmware's CAS READ and the record it seeks can be found,
+					// supply the record directly and return.
+					if(use_fast_tape_ && address == cas_read_address_ && lower_rom_is_paged_ && read_tape_record()) {
+						*cycle.value = 0xc9;
+						break;
+					}
+					// deliberate fallthrough
 				case CPU::Z80::PartialMachineCycle::Read:
 					*cycle.value = read_pointers_[address >> 14][address & 16383];
 				break;
 
 				case CPU::Z80::PartialMachineCycle::Write:
-					write_pointers_[address >> 14][address & 16383] = *cycle.value;
+					write_to_ram(address, *cycle.value);
 				break;
 
 				case CPU::Z80::PartialMachineCycle::Output:
@@ -777,7 +871,7 @@ class ConcreteMachine:
 					// Check for an upper ROM selection
 					if(has_fdc_ && !(address&0x2000)) {
 						upper_rom_ = (*cycle.value == 7) ? ROMType::AMSDOS : rom_model_ + 1;
-						if(upper_rom_is_paged_) read_pointers_[3] = roms_[upper_rom_].data();
+						if(upper_rom_is_paged_) read_pointers_[3] = roms_[upper_rom_]->data();
 					}
 
 					// Check for a CRTC access
@@ -862,7 +956,7 @@ class ConcreteMachine:
 
 		/// A CRTMachine function; indicates that outputs should be created now.
 		void setup_output(float aspect_ratio) override final {
-			crtc_bus_handler_.setup_output(aspect_ratio);
+			crtc_bus_handler_.setup_output(aspect_ratio, get_output_backend());
 		}
 
 		/// A CRTMachine function; indicates that outputs should be destroyed now.
@@ -908,18 +1002,9 @@ class ConcreteMachine:
 			}
 
 			// Establish default memory map
-			upper_rom_is_paged_ = true;
+			lower_rom_is_paged_ = upper_rom_is_paged_ = true;
 			upper_rom_ = rom_model_ + 1;
-
-			write_pointers_[0] = &ram_[0];
-			write_pointers_[1] = &ram_[16384];
-			write_pointers_[2] = &ram_[32768];
-			write_pointers_[3] = &ram_[49152];
-
-			read_pointers_[0] = roms_[rom_model_].data();
-			read_pointers_[1] = write_pointers_[1];
-			read_pointers_[2] = write_pointers_[2];
-			read_pointers_[3] = roms_[upper_rom_].data();
+			update_paging();
 
 			// Type whatever is required.
 			if(!cpc_target->loading_command.empty()) {
@@ -933,6 +1018,7 @@ class ConcreteMachine:
 			// If there are any tapes supplied, use the first of them.
 			if(!media.tapes.empty()) {
 				tape_player_.set_tape(media.tapes.front());
+				set_use_fast_tape();
 			}
 
 			// Insert up to four disks.
@@ -960,8 +1046,8 @@ class ConcreteMachine:
 			for(std::size_t index = 0; index < roms.size(); ++index) {
 				auto &data = roms[index];
 				if(!data) return false;
-				roms_[static_cast<int>(index)] = std::move(*data);
-				roms_[static_cast<int>(index)].resize(16384);
+				roms_[static_cast<int>(index)] = std::move(data);
+				roms_[static_cast<int>(index)]->resize(16384);
 			}
 
 			return true;
@@ -970,6 +1056,7 @@ class ConcreteMachine:
 		void set_component_is_sleeping(Sleeper *component, bool is_sleeping) override final {
 			fdc_is_sleeping_ = fdc_.is_sleeping();
 			tape_player_is_sleeping_ = tape_player_.is_sleeping();
+			set_use_fast_tape();
 		}
 
 // MARK: - Keyboard
@@ -1001,23 +1088,184 @@ class ConcreteMachine:
 			return &keyboard_mapper_;
 		}
 
+		// MARK: - Configuration options.
+		std::vector<std::unique_ptr<Configurable::Option>> get_options() override {
+			return AmstradCPC::get_options();
+		}
+
+		void set_selections(const Configurable::SelectionSet &selections_by_option) override {
+			bool quickload;
+			if(Configurable::get_quick_load_tape(selections_by_option, quickload)) {
+				allow_fast_tape_ = quickload;
+				set_use_fast_tape();
+			}
+		}
+
+		Configurable::SelectionSet get_accurate_selections() override {
+			Configurable::SelectionSet selection_set;
+			Configurable::append_quick_load_tape_selection(selection_set, false);
+			return selection_set;
+		}
+
+		Configurable::SelectionSet get_user_friendly_selections() override {
+			Configurable::SelectionSet selection_set;
+			Configurable::append_quick_load_tape_selection(selection_set, true);
+			return selection_set;
+		}
+
 		// MARK: - Activity Source
 		void set_activity_observer(Activity::Observer *observer) override {
 			if(has_fdc_) fdc_.set_activity_observer(observer);
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			serialise(archive, true);
+		}
+
+		SnapshotMachine::Machine *fork() override {
+			ConcreteMachine *const child = new ConcreteMachine(this);
+
+			// Insert the same media, which is shared rather than copied, and apply the same selections.
+			child->tape_player_.set_tape(tape_player_.get_tape());
+			if(has_fdc_) child->fdc_.set_disk(fdc_.get_disk(0), 0);
+			child->allow_fast_tape_ = allow_fast_tape_;
+
+			// Transfer everything else as a snapshot; this also returns a shared tape to this machine's position.
+			State::Archive recorder;
+			serialise(recorder, false);
+			State::Archive restorer(recorder.get_data());
+			child->serialise(restorer, false);
+			child->set_use_fast_tape();
+			return child;
+		}
 
 	private:
+		void serialise(State::Archive &archive, bool include_ram) {
+			archive.tag("AmstradCPC");
+			z80_.serialise(archive);
+			if(include_ram) ram_.serialise(archive);
+			archive(clock_offset_, crtc_counter_);
+
+			// Paging is recorded as the RAM bank visible in each quarter, plus whether each ROM is visible.
+			archive(ram_banks_, lower_rom_is_paged_, upper_rom_is_paged_, upper_rom_);
+
+			crtc_bus_handler_.serialise(archive);
+			crtc_.serialise(archive);
+			ay_.serialise(archive);
+			i8255_.serialise(archive);
+			key_state_.serialise(archive);
+			interrupt_timer_.serialise(archive);
+			tape_player_.serialise(archive);
+			fdc_.serialise(archive);
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				if(upper_rom_ < 0 || upper_rom_ > ROMType::AMSDOS) {
+					archive.invalidate();
+					return;
+				}
+				for(int c = 0; c < 4; ++c) {
+					if(ram_banks_[c] > (has_128k_ ? 7 : 3)) {
+						archive.invalidate();
+						return;
+					}
+				}
+				update_paging();
+			}
+		}
+
+		/// Establishes read and write pointers for the current RAM banks and ROM selections. Banks that are
+		/// currently shared with a fork are given no write pointer, so that the first write to each can be caught.
+		void update_paging() {
+			for(int c = 0; c < 4; ++c) {
+				read_pointers_[c] = ram_.page(ram_banks_[c]);
+				write_pointers_[c] = ram_.is_private(ram_banks_[c]) ? read_pointers_[c] : nullptr;
+				ram_pages_[c] = ram_.page(static_cast<std::size_t>(c));
+			}
+			if(lower_rom_is_paged_) read_pointers_[0] = roms_[rom_model_]->data();
+			if(upper_rom_is_paged_) read_pointers_[3] = roms_[upper_rom_]->data();
+			update_cas_read_address();
+		}
+
+		inline void write_to_ram(uint16_t address, uint8_t value) {
+			// A bank without a write pointer is shared with a fork; take a private copy before writing.
+			if(!write_pointers_[address >> 14]) {
+				ram_.make_private(ram_banks_[address >> 14]);
+				update_paging();
+			}
+			write_pointers_[address >> 14][address & 16383] = value;
+
+			// Catch any change to the CAS READ jumpblock entry.
+			if(static_cast<uint16_t>(address - 0xbca1) < 3) update_cas_read_address();
+		}
+
+		// MARK: - Fast tape loading.
+
+		/// The address in the lower ROM of the firmware's CAS READ, as per its jumpblock entry, or 0xffff if that entry
+		/// isn't a standard LOW JUMP into the lower ROM. Updated whenever paging or the jumpblock entry changes.
+		uint16_t cas_read_address_ = 0xffff;
+
+		void update_cas_read_address() {
+			cas_read_address_ = 0xffff;
+			const uint8_t *const entry = &read_pointers_[2][0xbca1 & 16383];
+			if(entry[0] != 0xcf) return;
+
+			// Bit 14 of the LOW JUMP address is set if the lower ROM is to be disabled.
+			const uint16_t target = static_cast<uint16_t>(entry[1] | (entry[2] << 8));
+			if(target & 0x4000) return;
+			cas_read_address_ = target & 0x3fff;
+		}
+
+		/// Performs a CAS READ via the tape parser, filling DE bytes from HL with the next record that has
+		/// the sync byte in A. @returns @c true if such a record was found and read successfully; @c false
+		/// otherwise, in which case the tape is restored to where it was, so that the firmware can try for itself.
+		bool read_tape_record() {
+			const uint16_t length = z80_.get_value_of_register(CPU::Z80::Register::DE);
+			if(!length) return false;
+
+			// The firmware runs the motor for the duration of a read, then restores it.
+			using Parser = Storage::Tape::AmstradCPC::Parser;
+			const uint64_t tape_position = tape_player_.get_tape()->get_offset();
+			const bool motor_was_running = tape_player_.get_motor_control();
+			tape_player_.set_motor_control(true);
+			std::unique_ptr<std::vector<uint8_t>> record = Parser::read_record(
+				static_cast<uint8_t>(z80_.get_value_of_register(CPU::Z80::Register::A)),
+				length,
+				tape_player_);
+			tape_player_.set_motor_control(motor_was_running);
+
+			if(!record) {
+				tape_player_.get_tape()->set_offset(tape_position);
+				return false;
+			}
+
+			uint16_t destination = z80_.get_value_of_register(CPU::Z80::Register::HL);
+			for(const auto byte: *record) {
+				write_to_ram(destination, byte);
+				++destination;
+			}
+
+			// Signal success: carry set and zero reset.
+			const uint16_t flags = z80_.get_value_of_register(CPU::Z80::Register::Flags);
+			z80_.set_value_of_register(CPU::Z80::Register::Flags, (flags | CPU::Z80::Flag::Carry) & ~CPU::Z80::Flag::Zero);
+			return true;
+		}
+
+		bool allow_fast_tape_ = false;
+		bool use_fast_tape_ = false;
+		void set_use_fast_tape() {
+			use_fast_tape_ = allow_fast_tape_ && tape_player_.has_tape() && !tape_player_.get_tape()->is_at_end();
+		}
+
 		inline void write_to_gate_array(uint8_t value) {
 			switch(value >> 6) {
 				case 0: crtc_bus_handler_.select_pen(value & 0x1f);		break;
 				case 1: crtc_bus_handler_.set_colour(value & 0x1f);		break;
 				case 2:
 					// Perform ROM paging.
-					read_pointers_[0] = (value & 4) ? write_pointers_[0] : roms_[rom_model_].data();
-
+					lower_rom_is_paged_ = !(value & 4);
 					upper_rom_is_paged_ = !(value & 8);
-					read_pointers_[3] = upper_rom_is_paged_ ? roms_[upper_rom_].data() : write_pointers_[3];
+					update_paging();
 
 					// Reset the interrupt timer if requested.
 					if(value & 0x10) interrupt_timer_.reset_count();
@@ -1028,10 +1276,7 @@ class ConcreteMachine:
 				case 3:
 					// Perform RAM paging, if 128kb is permitted.
 					if(has_128k_) {
-						bool adjust_low_read_pointer = read_pointers_[0] == write_pointers_[0];
-						bool adjust_high_read_pointer = read_pointers_[3] == write_pointers_[3];
-#define RAM_BANK(x) &ram_[x * 16384]
-#define RAM_CONFIG(a, b, c, d) write_pointers_[0] = RAM_BANK(a); write_pointers_[1] = RAM_BANK(b); write_pointers_[2] = RAM_BANK(c); write_pointers_[3] = RAM_BANK(d);
+#define RAM_CONFIG(a, b, c, d) ram_banks_[0] = a; ram_banks_[1] = b; ram_banks_[2] = c; ram_banks_[3] = d;
 						switch(value & 7) {
 							case 0:	RAM_CONFIG(0, 1, 2, 3);	break;
 							case 1:	RAM_CONFIG(0, 1, 2, 7);	break;
@@ -1043,11 +1288,7 @@ class ConcreteMachine:
 							case 7:	RAM_CONFIG(0, 7, 2, 3);	break;
 						}
 #undef RAM_CONFIG
-#undef RAM_BANK
-						if(adjust_low_read_pointer) read_pointers_[0] = write_pointers_[0];
-						read_pointers_[1] = write_pointers_[1];
-						read_pointers_[2] = write_pointers_[2];
-						if(adjust_high_read_pointer) read_pointers_[3] = write_pointers_[3];
+						update_paging();
 					}
 				break;
 			}
@@ -1071,16 +1312,18 @@ class ConcreteMachine:
 		HalfCycles crtc_counter_;
 		HalfCycles half_cycles_since_ay_update_;
 
-		uint8_t ram_[128 * 1024];
+		Memory::CopyOnWritePages<16384> ram_;
 
-		std::vector<uint8_t> roms_[7];
+		std::shared_ptr<std::vector<uint8_t>> roms_[7];
 		int rom_model_;
 		bool has_fdc_, fdc_is_sleeping_;
 		bool tape_player_is_sleeping_;
 		bool has_128k_;
-		bool upper_rom_is_paged_;
+		bool lower_rom_is_paged_ = false;
+		bool upper_rom_is_paged_ = false;
 		int upper_rom_;
 
+		uint8_t ram_banks_[4] = {0, 1, 2, 3};
 		uint8_t *ram_pages_[4];
 		uint8_t *read_pointers_[4];
 		uint8_t *write_pointers_[4];
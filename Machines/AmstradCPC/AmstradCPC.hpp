@@ -9,6 +9,8 @@
 #ifndef AmstradCPC_hpp
 #define AmstradCPC_hpp
 
+#include "../../Configurable/Configurable.hpp"
+
 namespace AmstradCPC {
 
 /*!
@@ -22,6 +24,9 @@ class Machine {
 		static Machine *AmstradCPC();
 };
 
+/// @returns The options available for an Amstrad CPC.
+std::vector<std::unique_ptr<Configurable::Option>> get_options();
+
 }
 
 #endif /* AmstradCPC_hpp */
@@ -12,6 +12,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 #include "../Utility/MemoryFuzzer.hpp"
 #include "../Utility/StringSerialiser.hpp"
 
@@ -38,7 +39,8 @@ class ConcreteMachine:
 	public CPU::MOS6502::BusHandler,
 	public Inputs::Keyboard,
 	public AppleII::Machine,
-	public Activity::Source {
+	public Activity::Source,
+	public SnapshotMachine::Machine {
 	private:
 		struct VideoBusHandler : public AppleII::Video::BusHandler {
 			public:
@@ -153,7 +155,7 @@ class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override {
-			video_.reset(new AppleII::Video::Video<VideoBusHandler>(video_bus_handler_));
+			video_.reset(new AppleII::Video::Video<VideoBusHandler>(video_bus_handler_, get_output_backend()));
 			video_->set_character_rom(character_rom_);
 		}
 
@@ -420,6 +422,35 @@ class ConcreteMachine:
 				if(card) card->set_activity_observer(observer);
 			}
 		}
+
+		// MARK: SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag("AppleII");
+			m6502_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			archive.bytes(aux_ram_, sizeof(aux_ram_));
+			archive(keyboard_input_, cycles_into_current_line_, cycles_since_audio_update_, language_card_);
+
+			video_->serialise(archive);
+			audio_toggle_.serialise(archive);
+
+			for(const auto &card: cards_) {
+				bool has_card = !!card;
+				archive(has_card);
+				if(has_card != !!card) {
+					archive.invalidate();
+					return;
+				}
+				if(card) card->serialise(archive);
+			}
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				set_language_card_paging();
+			}
+		}
 };
 
 }
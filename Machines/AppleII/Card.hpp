@@ -12,6 +12,7 @@
 #include "../../Processors/6502/6502.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
 #include "../../Activity/Observer.hpp"
+#include "../../State/Archive.hpp"
 
 namespace AppleII {
 
@@ -25,6 +26,9 @@ class Card {
 
 		/*! Supplies a target for observers. */
 		virtual void set_activity_observer(Activity::Observer *observer) {}
+
+		/*! Records or restores the card's state. */
+		virtual void serialise(State::Archive &archive) {}
 };
 
 }
@@ -44,3 +44,7 @@ void DiskIICard::set_disk(const std::shared_ptr<Storage::Disk::Disk> &disk, int
 void DiskIICard::set_activity_observer(Activity::Observer *observer) {
 	diskii_.set_activity_observer(observer);
 }
+
+void DiskIICard::serialise(State::Archive &archive) {
+	diskii_.serialise(archive);
+}
@@ -28,6 +28,7 @@ class DiskIICard: public Card {
 		void perform_bus_operation(CPU::MOS6502::BusOperation operation, uint16_t address, uint8_t *value) override;
 		void run_for(Cycles cycles, int stretches) override;
 		void set_activity_observer(Activity::Observer *observer) override;
+		void serialise(State::Archive &archive) override;
 
 		void set_disk(const std::shared_ptr<Storage::Disk::Disk> &disk, int drive);
 
@@ -18,10 +18,14 @@ struct ScaledByteFiller {
 	}
 } throwaway;
 
+uint32_t software_composite_sample(const uint8_t *sample, unsigned int icoordinate) {
+	return ((sample[0] >> (icoordinate % 7)) & 1) ? 0xffffff : 0x000000;
 }
 
-VideoBase::VideoBase() :
-	crt_(new Outputs::CRT::CRT(455, 1, Outputs::CRT::DisplayType::NTSC60, 1)) {
+}
+
+VideoBase::VideoBase(Outputs::CRT::OutputBackend backend) :
+	crt_(new Outputs::CRT::CRT(455, 1, Outputs::CRT::DisplayType::NTSC60, 1, backend)) {
 
 	// Set a composite sampling function that assumes 1bpp input, and uses just 7 bits per byte.
 	crt_->set_composite_sampling_function(
@@ -32,12 +36,31 @@ VideoBase::VideoBase() :
 			"return float(texValue & 1u);"
 		"}");
 	crt_->set_integer_coordinate_multiplier(7.0f);
+	crt_->set_software_sampling_function(software_composite_sample);
 
 	// Show only the centre 75% of the TV frame.
 	crt_->set_video_signal(Outputs::CRT::VideoSignal::Composite);
 	crt_->set_visible_area(Outputs::CRT::Rect(0.115f, 0.117f, 0.77f, 0.77f));
 }
 
+void VideoBase::serialise(State::Archive &archive) {
+	archive.tag("AppleIIVideo");
+	archive(video_page_, row_, column_, flash_, graphics_mode_, use_graphics_mode_, mixed_mode_, graphics_carry_);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		if(row_ < 0 || row_ >= 262 || column_ < 0 || column_ >= 65 || video_page_ & ~1) {
+			archive.invalidate();
+			return;
+		}
+
+		// Pixels are gathered into a single write area per line, so one is needed if restoring mid-line.
+		pixel_pointer_ = nullptr;
+		if(row_ < 192 && column_ > 0 && column_ < 40) {
+			pixel_pointer_ = reinterpret_cast<uint16_t *>(crt_->allocate_write_area(80, 2));
+		}
+	}
+}
+
 Outputs::CRT::CRT *VideoBase::get_crt() {
 	return crt_.get();
 }
@@ -11,6 +11,7 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 #include <vector>
 
@@ -26,7 +27,7 @@ class BusHandler {
 
 class VideoBase {
 	public:
-		VideoBase();
+		VideoBase(Outputs::CRT::OutputBackend backend);
 		static void setup_tables();
 
 		/// @returns The CRT this video feed is feeding.
@@ -43,6 +44,12 @@ class VideoBase {
 		// Setup for text mode.
 		void set_character_rom(const std::vector<uint8_t> &);
 
+		/*!
+			Records or restores the soft switches and raster position. Output resumes into a fresh
+			write area if restored mid-line.
+		*/
+		void serialise(State::Archive &archive);
+
 	protected:
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
 
@@ -67,8 +74,8 @@ class VideoBase {
 template <class BusHandler> class Video: public VideoBase {
 	public:
 		/// Constructs an instance of the video feed; a CRT is also created.
-		Video(BusHandler &bus_handler) :
-			VideoBase(),
+		Video(BusHandler &bus_handler, Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL) :
+			VideoBase(backend),
 			bus_handler_(bus_handler) {}
 
 		/*!
@@ -14,6 +14,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../JoystickMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../Analyser/Static/Atari/Target.hpp"
 
@@ -81,6 +82,7 @@ class ConcreteMachine:
 	public CRTMachine::Machine,
 	public ConfigurationTarget::Machine,
 	public JoystickMachine::Machine,
+	public SnapshotMachine::Machine,
 	public Outputs::CRT::Delegate {
 	public:
 		ConcreteMachine() {
@@ -170,7 +172,7 @@ class ConcreteMachine:
 
 		// to satisfy CRTMachine::Machine
 		void setup_output(float aspect_ratio) override {
-			bus_->tia_.reset(new TIA);
+			bus_->tia_.reset(new TIA(get_output_backend()));
 			bus_->speaker_.set_input_rate(static_cast<float>(get_clock_rate() / static_cast<double>(CPUTicksPerAudioTick)));
 			bus_->tia_->get_crt()->set_delegate(this);
 		}
@@ -213,20 +215,20 @@ class ConcreteMachine:
 						frame_records_[c].number_of_unexpected_vertical_syncs = 0;
 					}
 					is_ntsc_ ^= true;
+					apply_output_mode();
+				}
+			}
+		}
 
-					double clock_rate;
-					if(is_ntsc_) {
-						clock_rate = NTSC_clock_rate;
-						bus_->tia_->set_output_mode(TIA::OutputMode::NTSC);
-					} else {
-						clock_rate = PAL_clock_rate;
-						bus_->tia_->set_output_mode(TIA::OutputMode::PAL);
-					}
+		// to satisfy SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			archive.tag("Atari2600");
+			const bool was_ntsc = is_ntsc_;
+			archive(frame_records_, frame_record_pointer_, is_ntsc_);
+			bus_->serialise(archive);
 
-					bus_->speaker_.set_input_rate(static_cast<float>(clock_rate / static_cast<double>(CPUTicksPerAudioTick)));
-					bus_->speaker_.set_high_frequency_cutoff(static_cast<float>(clock_rate / (static_cast<double>(CPUTicksPerAudioTick) * 2.0)));
-					set_clock_rate(clock_rate);
-				}
+			if(!archive.is_saving() && is_ntsc_ != was_ntsc) {
+				apply_output_mode();
 			}
 		}
 
@@ -238,6 +240,21 @@ class ConcreteMachine:
 		// the bus
 		std::unique_ptr<Bus> bus_;
 
+		void apply_output_mode() {
+			double clock_rate;
+			if(is_ntsc_) {
+				clock_rate = NTSC_clock_rate;
+				bus_->tia_->set_output_mode(TIA::OutputMode::NTSC);
+			} else {
+				clock_rate = PAL_clock_rate;
+				bus_->tia_->set_output_mode(TIA::OutputMode::PAL);
+			}
+
+			bus_->speaker_.set_input_rate(static_cast<float>(clock_rate / static_cast<double>(CPUTicksPerAudioTick)));
+			bus_->speaker_.set_high_frequency_cutoff(static_cast<float>(clock_rate / (static_cast<double>(CPUTicksPerAudioTick) * 2.0)));
+			set_clock_rate(clock_rate);
+		}
+
 		// output frame rate tracker
 		struct FrameRecord {
 			unsigned int number_of_frames;
@@ -20,6 +20,7 @@ class BusExtender: public CPU::MOS6502::BusHandler {
 		BusExtender(uint8_t *rom_base, std::size_t rom_size) : rom_base_(rom_base), rom_size_(rom_size) {}
 
 		void advance_cycles(int cycles) {}
+		void serialise(State::Archive &archive) {}
 
 	protected:
 		uint8_t *rom_base_;
@@ -58,6 +59,22 @@ template<class T> class Cartridge:
 
 		void set_reset_line(bool state)		{ m6502_.set_reset_line(state);	}
 
+		void serialise(State::Archive &archive) {
+			// Bring audio up to date so that the sound generator is idle and current.
+			update_audio();
+			audio_queue_.perform();
+			audio_queue_.flush();
+
+			archive.tag("Atari2600Cartridge");
+			m6502_.serialise(archive);
+			bus_extender_.serialise(archive);
+			mos6532_.serialise(archive);
+			tia_->serialise(archive);
+			tia_sound_.serialise(archive);
+			archive(tia_input_value_, cycles_since_speaker_update_, cycles_since_video_update_, cycles_since_6532_update_);
+			archive(horizontal_counter_resets_, cycle_count_);
+		}
+
 		// to satisfy CPU::MOS6502::Processor
 		Cycles perform_bus_operation(CPU::MOS6502::BusOperation operation, uint16_t address, uint8_t *value) {
 			uint8_t returnValue = 0xff;
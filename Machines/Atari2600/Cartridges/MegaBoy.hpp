@@ -36,6 +36,11 @@ class MegaBoy: public BusExtender {
 			}
 		}
 
+		void serialise(State::Archive &archive) {
+			archive.pointer(rom_ptr_, rom_base_, rom_size_);
+			archive(current_page_);
+		}
+
 	private:
 		uint8_t *rom_ptr_;
 		uint8_t current_page_;
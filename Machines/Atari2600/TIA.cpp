@@ -20,11 +20,29 @@ namespace {
 	const int blank_flag = 0x2;
 
 	uint8_t reverse_table[256];
+
+	uint32_t ntsc_software_sample(const uint8_t *sample, unsigned int) {
+		const int phase = sample[0] >> 4;
+		return Outputs::CRT::software_colour_for_chrominance(
+			static_cast<float>(sample[0] & 14) / 14.0f,
+			6.283185308f * static_cast<float>(phase) / 13.0f + 5.074880441076923f,
+			phase ? 1.0f : 0.0f);
+	}
+
+	uint32_t pal_software_sample(const uint8_t *sample, unsigned int) {
+		const int phase = sample[0] >> 4;
+		const int direction = phase & 1;
+		const float phase_offset = (static_cast<float>(7 - direction) + (static_cast<float>(direction) - 0.5f) * 2.0f * static_cast<float>(phase >> 1)) * 6.283185308f / 12.0f;
+		return Outputs::CRT::software_colour_for_chrominance(
+			static_cast<float>(sample[0] & 14) / 14.0f,
+			phase_offset,
+			(((phase + 2) & 15) >= 4) ? 1.0f : 0.0f);
+	}
 }
 
-TIA::TIA(bool create_crt) {
+TIA::TIA(bool create_crt, Outputs::CRT::OutputBackend backend) {
 	if(create_crt) {
-		crt_.reset(new Outputs::CRT::CRT(cycles_per_line * 2 - 1, 1, Outputs::CRT::DisplayType::NTSC60, 1));
+		crt_.reset(new Outputs::CRT::CRT(cycles_per_line * 2 - 1, 1, Outputs::CRT::DisplayType::NTSC60, 1, backend));
 		crt_->set_video_signal(Outputs::CRT::VideoSignal::Composite);
 		set_output_mode(OutputMode::NTSC);
 	}
@@ -113,12 +131,23 @@ TIA::TIA(bool create_crt) {
 	}
 }
 
-TIA::TIA() : TIA(true) {}
+TIA::TIA(Outputs::CRT::OutputBackend backend) : TIA(true, backend) {}
 
-TIA::TIA(std::function<void(uint8_t *output_buffer)> line_end_function) : TIA(false) {
+TIA::TIA(std::function<void(uint8_t *output_buffer)> line_end_function) : TIA(false, Outputs::CRT::OutputBackend::OpenGL) {
 	line_end_function_ = line_end_function;
 }
 
+void TIA::serialise(State::Archive &archive) {
+	archive.tag("TIA");
+	archive(horizontal_counter_, output_mode_, collision_buffer_, collision_flags_, colour_palette_);
+	archive(background_half_mask_, playfield_priority_, background_, horizontal_blank_extend_);
+	for(int c = 0; c < 2; ++c) {
+		player_[c].serialise(archive);
+		missile_[c].serialise(archive);
+	}
+	ball_.serialise(archive);
+}
+
 void TIA::set_output_mode(Atari2600::TIA::OutputMode output_mode) {
 	Outputs::CRT::DisplayType display_type;
 
@@ -133,6 +162,7 @@ void TIA::set_output_mode(Atari2600::TIA::OutputMode output_mode) {
 				"float phaseOffset = 6.283185308 * float(iPhase) / 13.0 + 5.074880441076923;"
 				"return vec2(float(y) / 14.0, step(1, iPhase) * cos(phase + phaseOffset));"
 			"}");
+		crt_->set_software_sampling_function(ntsc_software_sample);
 		display_type = Outputs::CRT::DisplayType::NTSC60;
 	} else {
 		crt_->set_svideo_sampling_function(
@@ -147,6 +177,7 @@ void TIA::set_output_mode(Atari2600::TIA::OutputMode output_mode) {
 				"phaseOffset *= 6.283185308 / 12.0;"
 				"return vec2(float(y) / 14.0, step(4, (iPhase + 2u) & 15u) * cos(phase + phaseOffset));"
 			"}");
+		crt_->set_software_sampling_function(pal_software_sample);
 		display_type = Outputs::CRT::DisplayType::PAL50;
 	}
 	crt_->set_video_signal(Outputs::CRT::VideoSignal::Composite);
@@ -12,12 +12,13 @@
 #include <cstdint>
 
 #include "../CRTMachine.hpp"
+#include "../../State/Archive.hpp"
 
 namespace Atari2600 {
 
 class TIA {
 	public:
-		TIA();
+		TIA(Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL);
 		// The supplied hook is for unit testing only; if instantiated with a line_end_function then it will
 		// be called with the latest collision buffer upon the conclusion of each line. What's a collision
 		// buffer? It's an implementation detail. If you're not writing a unit test, leave it alone.
@@ -75,8 +76,14 @@ class TIA {
 
 		Outputs::CRT::CRT *get_crt() { return crt_.get(); }
 
+		/*!
+			Records or restores all state that affects the TIA's future behaviour. The CRT and any
+			partially-output line are excluded.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
-		TIA(bool create_crt);
+		TIA(bool create_crt, Outputs::CRT::OutputBackend backend);
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
 		std::function<void(uint8_t *output_buffer)> line_end_function_;
 
@@ -145,6 +152,10 @@ class TIA {
 
 			// indicates whether this object is currently undergoing motion
 			bool is_moving = false;
+
+			void serialise(State::Archive &archive) {
+				archive(position, motion, motion_step, motion_time, is_moving);
+			}
 		};
 
 		// player state
@@ -159,6 +170,12 @@ class TIA {
 			int latched_pixel4_time = -1;
 			const bool enqueues = true;
 
+			void serialise(State::Archive &archive) {
+				Object<Player>::serialise(archive);
+				archive(adder, copy_flags, graphic, reverse_mask, graphic_index, pixel_position, pixel_counter, latched_pixel4_time);
+				archive(copy_index_, queue_, queue_read_pointer_, queue_write_pointer_);
+			}
+
 			inline void skip_pixels(const int count, int from_horizontal_counter) {
 				int old_pixel_counter = pixel_counter;
 				pixel_position = std::min(32, pixel_position + count * adder);
@@ -233,6 +250,11 @@ class TIA {
 			int size = 1;
 			const bool enqueues = false;
 
+			void serialise(State::Archive &archive) {
+				Object<HorizontalRun>::serialise(archive);
+				archive(pixel_position, size);
+			}
+
 			inline void skip_pixels(const int count, int from_horizontal_counter) {
 				pixel_position = std::max(0, pixel_position - count);
 			}
@@ -261,6 +283,11 @@ class TIA {
 			bool locked_to_player = false;
 			int copy_flags = 0;
 
+			void serialise(State::Archive &archive) {
+				HorizontalRun::serialise(archive);
+				archive(enabled, locked_to_player, copy_flags);
+			}
+
 			inline void output_pixels(uint8_t *const target, const int count, const uint8_t collision_identity, int from_horizontal_counter) {
 				if(!pixel_position) return;
 				if(enabled && !locked_to_player) {
@@ -277,6 +304,11 @@ class TIA {
 			int enabled_index = 0;
 			const int copy_flags = 0;
 
+			void serialise(State::Archive &archive) {
+				HorizontalRun::serialise(archive);
+				archive(enabled, enabled_index);
+			}
+
 			inline void output_pixels(uint8_t *const target, const int count, const uint8_t collision_identity, int from_horizontal_counter) {
 				if(!pixel_position) return;
 				if(enabled[enabled_index]) {
@@ -36,6 +36,11 @@ void Atari2600::TIASound::set_control(int channel, uint8_t control) {
 	});
 }
 
+void Atari2600::TIASound::serialise(State::Archive &archive) {
+	archive.tag("TIASound");
+	archive(volume_, divider_, control_, poly4_counter_, poly5_counter_, poly9_counter_, output_state_, divider_counter_);
+}
+
 #define advance_poly4(c) poly4_counter_[channel] = (poly4_counter_[channel] >> 1) | (((poly4_counter_[channel] << 3) ^ (poly4_counter_[channel] << 2))&0x008)
 #define advance_poly5(c) poly5_counter_[channel] = (poly5_counter_[channel] >> 1) | (((poly5_counter_[channel] << 4) ^ (poly5_counter_[channel] << 2))&0x010)
 #define advance_poly9(c) poly9_counter_[channel] = (poly9_counter_[channel] >> 1) | (((poly9_counter_[channel] << 4) ^ (poly9_counter_[channel] << 8))&0x100)
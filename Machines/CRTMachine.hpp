@@ -29,17 +29,25 @@ namespace CRTMachine {
 class Machine: public ROMMachine::Machine {
 	public:
 		/*!
-			Causes the machine to set up its CRT and, if it has one, speaker. The caller guarantees
-			that an OpenGL context is bound.
+			Causes the machine to set up its CRT and, if it has one, speaker. Unless a software output
+			backend has been selected, the caller guarantees that an OpenGL context is bound.
 		*/
 		virtual void setup_output(float aspect_ratio) = 0;
 
 		/*!
-			Gives the machine a chance to release all owned resources. The caller guarantees that the
-			OpenGL context is bound.
+			Gives the machine a chance to release all owned resources. Unless a software output
+			backend has been selected, the caller guarantees that the OpenGL context is bound.
 		*/
 		virtual void close_output() = 0;
 
+		/*!
+			Selects the backend to be used by the CRT created by the next call to @c setup_output.
+			The default is @c Outputs::CRT::OutputBackend::OpenGL.
+		*/
+		virtual void set_output_backend(Outputs::CRT::OutputBackend backend) {
+			output_backend_ = backend;
+		}
+
 		/// @returns The CRT this machine is drawing to. Should not be @c nullptr.
 		virtual Outputs::CRT::CRT *get_crt() = 0;
 
@@ -66,6 +74,9 @@ class Machine: public ROMMachine::Machine {
 		double get_clock_rate() {
 			return clock_rate_;
 		}
+		Outputs::CRT::OutputBackend get_output_backend() {
+			return output_backend_;
+		}
 
 		/*!
 			Maps from Configurable::Display to Outputs::CRT::VideoSignal and calls
@@ -98,6 +109,7 @@ class Machine: public ROMMachine::Machine {
 	private:
 		double clock_rate_ = 1.0;
 		double clock_conversion_error_ = 0.0;
+		Outputs::CRT::OutputBackend output_backend_ = Outputs::CRT::OutputBackend::OpenGL;
 };
 
 }
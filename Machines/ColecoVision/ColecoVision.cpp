@@ -17,6 +17,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../JoystickMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../ClockReceiver/ForceInline.hpp"
 
@@ -110,7 +111,8 @@ class ConcreteMachine:
 	public CPU::Z80::BusHandler,
 	public CRTMachine::Machine,
 	public ConfigurationTarget::Machine,
-	public JoystickMachine::Machine {
+	public JoystickMachine::Machine,
+	public SnapshotMachine::Machine {
 
 	public:
 		ConcreteMachine() :
@@ -134,7 +136,7 @@ class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override {
-			vdp_.reset(new TI::TMS9918(TI::TMS9918::TMS9918A));
+			vdp_.reset(new TI::TMS9918(TI::TMS9918::TMS9918A, get_output_backend()));
 			get_crt()->set_video_signal(Outputs::CRT::VideoSignal::Composite);
 		}
 
@@ -349,6 +351,25 @@ class ConcreteMachine:
 			return confidence_counter_.get_confidence();
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag("ColecoVision");
+			z80_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			archive(super_game_module_, joysticks_in_keypad_mode_, time_since_sn76489_update_, time_until_interrupt_);
+			// Only a megacart's second page can change after insertion; it is always a 16kb window within the cartridge.
+			if(is_megacart_) {
+				archive.pointer(cartridge_pages_[1], cartridge_.data(), cartridge_.size());
+			}
+
+			vdp_->serialise(archive);
+			sn76489_.serialise(archive);
+			ay_.serialise(archive);
+		}
+
 	private:
 		inline void page_megacart(uint16_t address) {
 			const std::size_t selected_start = (static_cast<std::size_t>(address&63) << 14) % cartridge_.size();
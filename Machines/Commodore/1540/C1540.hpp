@@ -44,6 +44,12 @@ class Machine: public MachineBase, public ROMMachine::Machine {
 		/// Inserts @c disk into the drive.
 		void set_disk(std::shared_ptr<Storage::Disk::Disk> disk);
 
+		/*!
+			Records or restores the drive's processor, VIAs, RAM, serial port levels, disk controller and head
+			position. The disk itself is not included.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
 		Personality personality_;
 };
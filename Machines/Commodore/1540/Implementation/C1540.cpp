@@ -8,6 +8,7 @@
 
 #include "../C1540.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <string>
@@ -65,19 +66,27 @@ Cycles MachineBase::perform_bus_operation(CPU::MOS6502::BusOperation operation,
 			*value = rom_[address & 0x3fff];
 		}
 	} else if(address >= 0x1800 && address <= 0x180f) {
+		update_vias();
 		if(isReadOperation(operation))
 			*value = serial_port_VIA_.get_register(address);
 		else
 			serial_port_VIA_.set_register(address, *value);
+		update_via_sequence_point();
 	} else if(address >= 0x1c00 && address <= 0x1c0f) {
+		update_vias();
 		if(isReadOperation(operation))
 			*value = drive_VIA_.get_register(address);
 		else
 			drive_VIA_.set_register(address, *value);
+		update_via_sequence_point();
 	}
 
-	serial_port_VIA_.run_for(Cycles(1));
-	drive_VIA_.run_for(Cycles(1));
+	// The VIAs are run only when accessed, or when one might next change its interrupt output.
+	time_since_via_update_ += Cycles(1);
+	if(time_since_via_update_ >= via_sequence_point_) update_vias();
+
+	// The disk need be clocked only while it is spinning.
+	if(!drive_->is_sleeping()) Storage::Disk::Controller::run_for(Cycles(1));
 
 	return Cycles(1);
 }
@@ -101,11 +110,39 @@ void Machine::set_disk(std::shared_ptr<Storage::Disk::Disk> disk) {
 
 void Machine::run_for(const Cycles cycles) {
 	m6502_.run_for(cycles);
+}
+
+void MachineBase::flush() {
+	// Serial line inputs may arrive between calls to run_for, so the VIAs are always caught up by the end of one.
+	update_vias();
+}
+
+void MachineBase::update_vias() {
+	const HalfCycles time_since_via_update = time_since_via_update_.flush();
+	serial_port_VIA_.run_for(time_since_via_update);
+	drive_VIA_.run_for(time_since_via_update);
+	update_via_sequence_point();
+}
+
+void MachineBase::update_via_sequence_point() {
+	via_sequence_point_ = std::min(serial_port_VIA_.get_next_sequence_point(), drive_VIA_.get_next_sequence_point());
+}
 
-	bool drive_motor = drive_VIA_port_handler_.get_motor_enabled();
-	drive_->set_motor_on(drive_motor);
-	if(drive_motor)
-		Storage::Disk::Controller::run_for(cycles);
+void Machine::serialise(State::Archive &archive) {
+	update_vias();
+
+	archive.tag("C1540");
+	m6502_.serialise(archive);
+	archive(ram_, shift_register_, bit_window_offset_);
+	drive_VIA_.serialise(archive);
+	drive_VIA_port_handler_.serialise(archive);
+	serial_port_VIA_.serialise(archive);
+	serial_port_VIA_port_handler_->serialise(archive);
+	serial_port_->serialise(archive);
+	Storage::Disk::Controller::serialise(archive);
+	drive_->serialise(archive);
+
+	if(!archive.is_saving()) update_via_sequence_point();
 }
 
 void MachineBase::set_activity_observer(Activity::Observer *observer) {
@@ -154,6 +191,10 @@ void MachineBase::drive_via_did_set_data_density(void *driveVIA, int density) {
 	set_expected_bit_length(Storage::Encodings::CommodoreGCR::length_of_a_bit_in_time_zone(static_cast<unsigned int>(density)));
 }
 
+void MachineBase::drive_via_did_set_drive_motor(void *driveVIA, bool enabled) {
+	drive_->set_motor_on(enabled);
+}
+
 // MARK: - SerialPortVIA
 
 SerialPortVIA::SerialPortVIA(MOS::MOS6522::MOS6522<SerialPortVIA> &via) : via_(via) {}
@@ -197,6 +238,10 @@ void SerialPortVIA::set_serial_port(const std::shared_ptr<::Commodore::Serial::P
 	serial_port_ = serialPort;
 }
 
+void SerialPortVIA::serialise(State::Archive &archive) {
+	archive(port_b_, attention_acknowledge_level_, attention_level_input_, data_level_output_);
+}
+
 void SerialPortVIA::update_data_line() {
 	std::shared_ptr<::Commodore::Serial::Port> serialPort = serial_port_.lock();
 	if(serialPort) {
@@ -244,7 +289,11 @@ void DriveVIA::set_port_output(MOS::MOS6522::Port port, uint8_t value, uint8_t d
 	if(port) {
 		if(previous_port_b_output_ != value) {
 			// record drive motor state
-			drive_motor_ = !!(value&4);
+			const bool drive_motor = !!(value&4);
+			if(drive_motor != drive_motor_) {
+				drive_motor_ = drive_motor;
+				if(delegate_) delegate_->drive_via_did_set_drive_motor(this, drive_motor_);
+			}
 
 			// check for a head step
 			int step_difference = ((value&3) - (previous_port_b_output_&3))&3;
@@ -274,6 +323,11 @@ void DriveVIA::set_activity_observer(Activity::Observer *observer) {
 	}
 }
 
+void DriveVIA::serialise(State::Archive &archive) {
+	archive(port_b_, port_a_, should_set_overflow_, drive_motor_, previous_port_b_output_);
+	if(!archive.is_saving() && observer_) observer_->set_led_status("Drive", !!(previous_port_b_output_&8));
+}
+
 // MARK: - SerialPort
 
 void SerialPort::set_input(::Commodore::Serial::Line line, ::Commodore::Serial::LineLevel level) {
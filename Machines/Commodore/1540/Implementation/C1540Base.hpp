@@ -48,6 +48,8 @@ class SerialPortVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 
 		void set_serial_port(const std::shared_ptr<::Commodore::Serial::Port> &);
 
+		void serialise(State::Archive &archive);
+
 	private:
 		MOS::MOS6522::MOS6522<SerialPortVIA> &via_;
 		uint8_t port_b_ = 0x0;
@@ -81,6 +83,7 @@ class DriveVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 			public:
 				virtual void drive_via_did_step_head(void *driveVIA, int direction) = 0;
 				virtual void drive_via_did_set_data_density(void *driveVIA, int density) = 0;
+				virtual void drive_via_did_set_drive_motor(void *driveVIA, bool enabled) = 0;
 		};
 		void set_delegate(Delegate *);
 
@@ -97,6 +100,8 @@ class DriveVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 
 		void set_activity_observer(Activity::Observer *observer);
 
+		void serialise(State::Archive &archive);
+
 	private:
 		uint8_t port_b_ = 0xff, port_a_ = 0xff;
 		bool should_set_overflow_ = false;
@@ -129,6 +134,7 @@ class MachineBase:
 
 		// to satisfy CPU::MOS6502::Processor
 		Cycles perform_bus_operation(CPU::MOS6502::BusOperation operation, uint16_t address, uint8_t *value);
+		void flush();
 
 		// to satisfy MOS::MOS6522::Delegate
 		virtual void mos6522_did_change_interrupt_status(void *mos6522);
@@ -136,6 +142,7 @@ class MachineBase:
 		// to satisfy DriveVIA::Delegate
 		void drive_via_did_step_head(void *driveVIA, int direction);
 		void drive_via_did_set_data_density(void *driveVIA, int density);
+		void drive_via_did_set_drive_motor(void *driveVIA, bool enabled);
 
 		/// Attaches the activity observer to this C1540.
 		void set_activity_observer(Activity::Observer *observer);
@@ -153,6 +160,10 @@ class MachineBase:
 
 		MOS::MOS6522::MOS6522<DriveVIA> drive_VIA_;
 		MOS::MOS6522::MOS6522<SerialPortVIA> serial_port_VIA_;
+		HalfCycles time_since_via_update_;
+		HalfCycles via_sequence_point_;
+		void update_vias();
+		void update_via_sequence_point();
 
 		int shift_register_ = 0, bit_window_offset_;
 		virtual void process_input_bit(int value);
@@ -13,6 +13,8 @@
 #include <memory>
 #include <vector>
 
+#include "../../State/Archive.hpp"
+
 namespace Commodore {
 namespace Serial {
 
@@ -63,6 +65,14 @@ namespace Serial {
 			*/
 			void set_line_output_did_change(Line line);
 
+			/*!
+				Records or restores the current bus levels. Ports are not informed of restored levels;
+				each port's owner is responsible for restoring whatever input state it retains.
+			*/
+			void serialise(State::Archive &archive) {
+				archive(line_levels_);
+			}
+
 		private:
 			LineLevel line_levels_[5];
 			std::vector<std::weak_ptr<Port>> ports_;
@@ -106,6 +116,11 @@ namespace Serial {
 				serial_bus_ = serial_bus;
 			}
 
+			/// Records or restores this port's output levels, without informing the bus.
+			void serialise(State::Archive &archive) {
+				archive(line_levels_);
+			}
+
 		private:
 			std::weak_ptr<Bus> serial_bus_;
 			LineLevel line_levels_[5];
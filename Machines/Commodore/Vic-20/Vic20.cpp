@@ -15,12 +15,15 @@
 #include "../../CRTMachine.hpp"
 #include "../../KeyboardMachine.hpp"
 #include "../../JoystickMachine.hpp"
+#include "../../SnapshotMachine.hpp"
 
 #include "../../../Processors/6502/6502.hpp"
 #include "../../../Components/6560/6560.hpp"
 #include "../../../Components/6522/6522.hpp"
 
+#include "../../../Activity/QueuedObserver.hpp"
 #include "../../../ClockReceiver/ForceInline.hpp"
+#include "../../../Concurrency/AsyncClockedComponent.hpp"
 
 #include "../../../Storage/Tape/Parsers/Commodore.hpp"
 
@@ -81,15 +84,15 @@ enum ROM {
 */
 class UserPortVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 	public:
-		UserPortVIA() : port_a_(0xbf) {}
+		UserPortVIA() : port_a_(0xbc) {}
 
 		/// Reports the current input to the 6522 port @c port.
 		uint8_t get_port_input(MOS::MOS6522::Port port) {
 			// Port A provides information about the presence or absence of a tape, and parts of
-			// the joystick and serial port state, both of which have been statefully collected
-			// into port_a_.
+			// the joystick and serial port state, which have been statefully collected into port_a_
+			// and serial_port_a_ respectively.
 			if(!port) {
-				return port_a_ | (tape_->has_tape() ? 0x00 : 0x40);
+				return port_a_ | serial_port_a_ | (tape_->has_tape() ? 0x00 : 0x40);
 			}
 			return 0xff;
 		}
@@ -103,11 +106,12 @@ class UserPortVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 		}
 
 		/// Receives announcements of changes in the serial bus connected to the serial port and propagates them into Port A.
+		/// These may arrive from the 1540's thread, so are kept apart from the joystick state, which may be set from another.
 		void set_serial_line_state(::Commodore::Serial::Line line, bool value) {
 			switch(line) {
 				default: break;
-				case ::Commodore::Serial::Line::Data: port_a_ = (port_a_ & ~0x02) | (value ? 0x02 : 0x00);	break;
-				case ::Commodore::Serial::Line::Clock: port_a_ = (port_a_ & ~0x01) | (value ? 0x01 : 0x00);	break;
+				case ::Commodore::Serial::Line::Data: serial_port_a_ = (serial_port_a_ & ~0x02) | (value ? 0x02 : 0x00);	break;
+				case ::Commodore::Serial::Line::Clock: serial_port_a_ = (serial_port_a_ & ~0x01) | (value ? 0x01 : 0x00);	break;
 			}
 		}
 
@@ -137,8 +141,14 @@ class UserPortVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 			tape_ = tape;
 		}
 
+		/// Records or restores the collected serial line and joystick state.
+		void serialise(State::Archive &archive) {
+			archive(port_a_, serial_port_a_);
+		}
+
 	private:
 		uint8_t port_a_;
+		uint8_t serial_port_a_ = 0x03;
 		std::weak_ptr<::Commodore::Serial::Port> serial_port_;
 		std::shared_ptr<Storage::Tape::BinaryTapePlayer> tape_;
 };
@@ -211,6 +221,11 @@ class KeyboardVIA: public MOS::MOS6522::IRQDelegatePortHandler {
 			serial_port_ = serialPort;
 		}
 
+		/// Records or restores the current keyboard row selection.
+		void serialise(State::Archive &archive) {
+			archive(activation_mask_);
+		}
+
 	private:
 		uint8_t port_b_;
 		uint8_t columns_[8];
@@ -305,7 +320,8 @@ class ConcreteMachine:
 	public Storage::Tape::BinaryTapePlayer::Delegate,
 	public Machine,
 	public Sleeper::SleepObserver,
-	public Activity::Source {
+	public Activity::Source,
+	public SnapshotMachine::Machine {
 	public:
 		ConcreteMachine() :
 				m6502_(*this),
@@ -389,6 +405,9 @@ class ConcreteMachine:
 
 				// give it a little warm up
 				c1540_->run_for(Cycles(2000000));
+
+				// from here on it runs on a thread of its own, up to 20ms behind this machine
+				c1540_runner_.reset(new Concurrency::AsyncClockedComponent<::Commodore::C1540::Machine>(*c1540_, Cycles(C1540BatchLength), Cycles(C1540MaximumLag)));
 			}
 
 			insert_media(target->media);
@@ -400,6 +419,7 @@ class ConcreteMachine:
 			}
 
 			if(!media.disks.empty() && c1540_) {
+				update_c1540();
 				c1540_->set_disk(media.disks.front());
 			}
 
@@ -420,8 +440,11 @@ class ConcreteMachine:
 		void set_key_state(uint16_t key, bool is_pressed) override final {
 			if(key != KeyRestore)
 				keyboard_via_port_handler_->set_key_state(key, is_pressed);
-			else
+			else {
+				update_vias();
 				user_port_via_.set_control_line_input(MOS::MOS6522::Port::A, MOS::MOS6522::Line::One, !is_pressed);
+				update_via_sequence_point();
+			}
 		}
 
 		void clear_all_keys() override final {
@@ -563,8 +586,13 @@ class ConcreteMachine:
 						update_video();
 						result &= mos6560_->get_register(address);
 					}
-					if(address & 0x10) result &= user_port_via_.get_register(address);
-					if(address & 0x20) result &= keyboard_via_.get_register(address);
+					if(address & 0x30) {
+						update_c1540();
+						update_vias();
+						if(address & 0x10) result &= user_port_via_.get_register(address);
+						if(address & 0x20) result &= keyboard_via_.get_register(address);
+						update_via_sequence_point();
+					}
 				}
 				*value = result;
 
@@ -650,15 +678,21 @@ class ConcreteMachine:
 						update_video();
 						mos6560_->set_register(address, *value);
 					}
-					// The first VIA is selected by bit 4 = 1.
-					if(address & 0x10) user_port_via_.set_register(address, *value);
-					// The second VIA is selected by bit 5 = 1.
-					if(address & 0x20) keyboard_via_.set_register(address, *value);
+					if(address & 0x30) {
+						update_c1540();
+						update_vias();
+						// The first VIA is selected by bit 4 = 1.
+						if(address & 0x10) user_port_via_.set_register(address, *value);
+						// The second VIA is selected by bit 5 = 1.
+						if(address & 0x20) keyboard_via_.set_register(address, *value);
+						update_via_sequence_point();
+					}
 				}
 			}
 
-			user_port_via_.run_for(Cycles(1));
-			keyboard_via_.run_for(Cycles(1));
+			// The VIAs are run only when accessed, or when one might next change its interrupt output.
+			time_since_via_update_ += Cycles(1);
+			if(time_since_via_update_ >= via_sequence_point_) update_vias();
 			if(typer_ && address == 0xeb1e && operation == CPU::MOS6502::BusOperation::ReadOpcode) {
 				if(!typer_->type_next_character()) {
 					clear_all_keys();
@@ -666,14 +700,19 @@ class ConcreteMachine:
 				}
 			}
 			if(!tape_is_sleeping_ && !hold_tape_) tape_->run_for(Cycles(1));
-			if(c1540_) c1540_->run_for(Cycles(1));
+			// The 1540 is observable only via the serial bus, which the Vic samples and drives solely through its VIAs;
+			// so it need be brought up to date only upon a VIA access, or when this machine otherwise flushes.
+			if(c1540_runner_) c1540_runner_->run_for(Cycles(1));
 
 			return Cycles(1);
 		}
 
 		void flush() {
 			update_video();
+			update_vias();
+			update_c1540();
 			mos6560_->flush();
+			c1540_activity_.deliver();
 		}
 
 		void run_for(const Cycles cycles) override final {
@@ -681,7 +720,7 @@ class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override final {
-			mos6560_.reset(new MOS::MOS6560::MOS6560<Vic6560BusHandler>(mos6560_bus_handler_));
+			mos6560_.reset(new MOS::MOS6560::MOS6560<Vic6560BusHandler>(mos6560_bus_handler_, get_output_backend()));
 			mos6560_->set_high_frequency_cutoff(1600);	// There is a 1.6Khz low-pass filter in the Vic-20.
 			// Make a guess: PAL. Without setting a clock rate the 6560 isn't fully set up so contractually something must be set.
 			set_memory_map(commodore_target_.memory_model, commodore_target_.region);
@@ -710,7 +749,9 @@ class ConcreteMachine:
 		}
 
 		void tape_did_change_input(Storage::Tape::BinaryTapePlayer *tape) override final {
+			update_vias();
 			keyboard_via_.set_control_line_input(MOS::MOS6522::Port::A, MOS::MOS6522::Line::One, !tape->get_input());
+			update_via_sequence_point();
 		}
 
 		KeyboardMapper *get_keyboard_mapper() override {
@@ -756,13 +797,67 @@ class ConcreteMachine:
 
 		// MARK: - Activity Source
 		void set_activity_observer(Activity::Observer *observer) override {
-			if(c1540_) c1540_->set_activity_observer(observer);
+			if(c1540_) {
+				// The 1540 may run on a thread of its own, so its activity is queued and passed on
+				// only upon a flush; that leaves the observer being called solely from this machine's thread.
+				update_c1540();
+				c1540_activity_.set_observer(observer);
+				c1540_->set_activity_observer(observer ? &c1540_activity_ : nullptr);
+				c1540_activity_.deliver();
+			}
+		}
+
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			update_video();
+			update_vias();
+			update_c1540();
+
+			archive.tag("Vic20");
+			m6502_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			archive.bytes(colour_ram_, sizeof(colour_ram_));
+
+			user_port_via_.serialise(archive);
+			user_port_via_port_handler_->serialise(archive);
+			keyboard_via_.serialise(archive);
+			keyboard_via_port_handler_->serialise(archive);
+			serial_port_->serialise(archive);
+			serial_bus_->serialise(archive);
+
+			tape_->serialise(archive);
+			archive(hold_tape_);
+
+			mos6560_->serialise(archive);
+
+			// A 1540 is present only if disk media was supplied; state recorded with one cannot be applied without.
+			bool has_c1540 = !!c1540_;
+			archive(has_c1540);
+			if(has_c1540 != !!c1540_) {
+				archive.invalidate();
+				return;
+			}
+			if(c1540_) c1540_->serialise(archive);
+
+			if(!archive.is_saving()) update_via_sequence_point();
 		}
 
 	private:
 		void update_video() {
 			mos6560_->run_for(cycles_since_mos6560_update_.flush());
 		}
+		void update_vias() {
+			const HalfCycles time_since_via_update = time_since_via_update_.flush();
+			user_port_via_.run_for(time_since_via_update);
+			keyboard_via_.run_for(time_since_via_update);
+			update_via_sequence_point();
+		}
+		void update_c1540() {
+			if(c1540_runner_) c1540_runner_->flush();
+		}
+		void update_via_sequence_point() {
+			via_sequence_point_ = std::min(user_port_via_.get_next_sequence_point(), keyboard_via_.get_next_sequence_point());
+		}
 		Analyser::Static::Commodore::Target commodore_target_;
 
 		CPU::MOS6502::Processor<ConcreteMachine, false> m6502_;
@@ -805,6 +900,8 @@ class ConcreteMachine:
 
 		MOS::MOS6522::MOS6522<UserPortVIA> user_port_via_;
 		MOS::MOS6522::MOS6522<KeyboardVIA> keyboard_via_;
+		HalfCycles time_since_via_update_;
+		HalfCycles via_sequence_point_;
 
 		// Tape
 		std::shared_ptr<Storage::Tape::BinaryTapePlayer> tape_;
@@ -817,7 +914,11 @@ class ConcreteMachine:
 		}
 
 		// Disk
+		Activity::QueuedObserver c1540_activity_;
 		std::shared_ptr<::Commodore::C1540::Machine> c1540_;
+		std::unique_ptr<Concurrency::AsyncClockedComponent<::Commodore::C1540::Machine>> c1540_runner_;
+		static constexpr int C1540BatchLength = 1024;
+		static constexpr int C1540MaximumLag = 20000;
 };
 
 }
@@ -15,6 +15,7 @@
 #include "CRTMachine.hpp"
 #include "JoystickMachine.hpp"
 #include "KeyboardMachine.hpp"
+#include "SnapshotMachine.hpp"
 #include "Utility/Typer.hpp"
 
 namespace Machine {
@@ -32,6 +33,10 @@ struct DynamicMachine {
 	virtual JoystickMachine::Machine *joystick_machine() = 0;
 	virtual KeyboardMachine::Machine *keyboard_machine() = 0;
 	virtual Configurable::Device *configurable_device() = 0;
+	virtual SnapshotMachine::Machine *snapshot_machine() = 0;
+
+	/// @returns A new dynamic machine owning a fork of this one, as per SnapshotMachine::Machine::fork, or @c nullptr if this machine cannot be forked.
+	virtual DynamicMachine *fork() = 0;
 
 	/*!
 		Provides a raw pointer to the underlying machine if and only if this dynamic machine really is
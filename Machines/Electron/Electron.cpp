@@ -12,6 +12,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
 #include "../../ClockReceiver/ForceInline.hpp"
@@ -47,7 +48,8 @@ class ConcreteMachine:
 	public CPU::MOS6502::BusHandler,
 	public Tape::Delegate,
 	public Utility::TypeRecipient,
-	public Activity::Source {
+	public Activity::Source,
+	public SnapshotMachine::Machine {
 	public:
 		ConcreteMachine() :
 			m6502_(*this),
@@ -407,7 +409,7 @@ class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override final {
-			video_output_.reset(new VideoOutput(ram_));
+			video_output_.reset(new VideoOutput(ram_, get_output_backend()));
 		}
 
 		void close_output() override final {
@@ -488,6 +490,47 @@ class ConcreteMachine:
 			}
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			update_display();
+			update_audio();
+			audio_queue_.perform();
+			audio_queue_.flush();
+
+			archive.tag("Electron");
+			m6502_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			for(int c = 0; c < 16; c++) {
+				if(rom_write_masks_[c]) archive.bytes(roms_[c], sizeof(roms_[c]));
+			}
+
+			archive(active_rom_, keyboard_is_active_, basic_is_active_);
+			archive(interrupt_status_, interrupt_control_);
+			archive(cycles_since_audio_update_, cycles_until_display_interrupt_, next_display_interrupt_, video_access_range_);
+			archive(fast_load_is_in_data_, is_holding_shift_, shift_restart_counter_, speaker_is_enabled_);
+
+			const bool had_caps_led = caps_led_state_;
+			archive(caps_led_state_);
+
+			video_output_->serialise(archive);
+			sound_generator_.serialise(archive);
+			tape_.serialise(archive);
+
+			bool has_plus3 = !!plus3_;
+			archive(has_plus3);
+			if(has_plus3 != !!plus3_) {
+				archive.invalidate();
+				return;
+			}
+			if(plus3_) plus3_->serialise(archive);
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				if(activity_observer_ && caps_led_state_ != had_caps_led) {
+					activity_observer_->set_led_status(caps_led, caps_led_state_);
+				}
+			}
+		}
+
 	private:
 		// MARK: - Work deferral updates.
 		inline void update_display() {
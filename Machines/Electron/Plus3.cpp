@@ -48,6 +48,30 @@ void Plus3::set_control_register(uint8_t control, uint8_t changes) {
 	if(changes & 0x08) set_is_double_density(!(control & 0x08));
 }
 
+void Plus3::serialise(State::Archive &archive) {
+	archive.tag("Plus3");
+	WD1770::serialise(archive);
+	archive(selected_drive_, last_control_);
+	if(selected_drive_ < -1 || selected_drive_ > 1) {
+		archive.invalidate();
+		return;
+	}
+
+	for(auto &drive: drives_) {
+		bool has_drive = !!drive;
+		archive(has_drive);
+		if(has_drive != !!drive) {
+			archive.invalidate();
+			return;
+		}
+		if(drive) drive->serialise(archive);
+	}
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		set_drive((selected_drive_ < 0) ? nullptr : drives_[selected_drive_]);
+	}
+}
+
 void Plus3::set_motor_on(bool on) {
 	// TODO: this status should transfer if the selected drive changes. But the same goes for
 	// writing state, so plenty of work to do in general here.
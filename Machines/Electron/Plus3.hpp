@@ -22,6 +22,9 @@ class Plus3 : public WD::WD1770 {
 		void set_control_register(uint8_t control);
 		void set_activity_observer(Activity::Observer *observer);
 
+		/// Records or restores the WD1770, the control register and both drives.
+		void serialise(State::Archive &archive);
+
 	private:
 		void set_control_register(uint8_t control, uint8_t changes);
 		std::shared_ptr<Storage::Disk::Drive> drives_[2];
@@ -35,6 +35,11 @@ void SoundGenerator::skip_samples(std::size_t number_of_samples) {
 	counter_ = (counter_ + number_of_samples) % ((divider_+1) * 2);
 }
 
+void SoundGenerator::serialise(State::Archive &archive) {
+	archive.tag("ElectronSound");
+	archive(counter_, divider_, is_enabled_);
+}
+
 void SoundGenerator::set_divider(uint8_t divider) {
 	audio_queue_.defer([=]() {
 		divider_ = divider * 32 / clock_rate_divider;
@@ -11,6 +11,7 @@
 
 #include "../../Outputs/Speaker/Implementation/SampleSource.hpp"
 #include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../State/Archive.hpp"
 
 namespace Electron {
 
@@ -29,6 +30,9 @@ class SoundGenerator: public ::Outputs::Speaker::SampleSource {
 		void skip_samples(std::size_t number_of_samples);
 		void set_sample_volume_range(std::int16_t range);
 
+		/// Records or restores the divider and output phase; must be called only while the audio queue is idle.
+		void serialise(State::Archive &archive);
+
 	private:
 		Concurrency::DeferringAsyncTaskQueue &audio_queue_;
 		unsigned int counter_ = 0;
@@ -65,6 +65,13 @@ uint8_t Tape::get_data_register() {
 	return static_cast<uint8_t>(data_register_ >> 2);
 }
 
+void Tape::serialise(State::Archive &archive) {
+	TapePlayer::serialise(archive);
+	archive.tag("ElectronTape");
+	archive(input_, output_, is_running_, is_enabled_, is_in_input_mode_, data_register_, interrupt_status_, last_posted_interrupt_status_);
+	shifter_.serialise(archive);
+}
+
 void Tape::process_input_pulse(const Storage::Tape::Tape::Pulse &pulse) {
 	shifter_.process_pulse(pulse);
 }
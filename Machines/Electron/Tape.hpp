@@ -46,6 +46,9 @@ class Tape:
 
 		void acorn_shifter_output_bit(int value);
 
+		/// Records or restores the tape position plus the ULA's serial shifter and interrupt state.
+		void serialise(State::Archive &archive);
+
 	private:
 		void process_input_pulse(const Storage::Tape::Tape::Pulse &pulse);
 		inline void push_tape_bit(uint16_t bit);
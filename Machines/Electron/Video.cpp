@@ -41,16 +41,24 @@ namespace {
 			*right_bookend = static_cast<uint8_t>(((*right_value) & 0xf0) | (((*right_value) & 0xf0) >> 4));
 		}
 	};
+
+	uint32_t software_rgb_sample(const uint8_t *sample, unsigned int icoordinate) {
+		const uint8_t value = static_cast<uint8_t>(sample[0] >> (4 - (icoordinate & 4)));
+		return
+			((value & 4) ? 0xff0000 : 0) |
+			((value & 2) ? 0x00ff00 : 0) |
+			((value & 1) ? 0x0000ff : 0);
+	}
 }
 
 // MARK: - Lifecycle
 
-VideoOutput::VideoOutput(uint8_t *memory) : ram_(memory) {
+VideoOutput::VideoOutput(uint8_t *memory, Outputs::CRT::OutputBackend backend) : ram_(memory) {
 	memset(palette_, 0xf, sizeof(palette_));
 	setup_screen_map();
 	setup_base_address();
 
-	crt_.reset(new Outputs::CRT::CRT(crt_cycles_per_line, 8, Outputs::CRT::DisplayType::PAL50, 1));
+	crt_.reset(new Outputs::CRT::CRT(crt_cycles_per_line, 8, Outputs::CRT::DisplayType::PAL50, 1, backend));
 	crt_->set_rgb_sampling_function(
 		"vec3 rgb_sample(usampler2D sampler, vec2 coordinate, vec2 icoordinate)"
 		"{"
@@ -59,6 +67,7 @@ VideoOutput::VideoOutput(uint8_t *memory) : ram_(memory) {
 			"return vec3( uvec3(texValue) & uvec3(4u, 2u, 1u));"
 		"}");
 	crt_->set_integer_coordinate_multiplier(8.0f);
+	crt_->set_software_sampling_function(software_rgb_sample);
 	std::unique_ptr<Outputs::CRT::TextureBuilder::Bookender> bookender(new FourBPPBookender);
 	crt_->set_bookender(std::move(bookender));
 	// TODO: as implied below, I've introduced a clock's latency into the graphics pipeline somehow. Investigate.
@@ -336,6 +345,26 @@ void VideoOutput::set_register(int address, uint8_t value) {
 	}
 }
 
+void VideoOutput::serialise(State::Archive &archive) {
+	archive.tag("ElectronVideo");
+	archive(output_position_, unused_cycles_);
+	archive(palette_, screen_mode_, screen_mode_base_address_, start_screen_address_, palette_tables_);
+	archive(start_line_address_, current_screen_address_, current_pixel_line_, current_pixel_column_, current_character_row_, last_pixel_byte_, is_blank_line_);
+	archive(current_output_divider_, cycles_into_draw_action_);
+
+	uint32_t screen_map_pointer = static_cast<uint32_t>(screen_map_pointer_);
+	archive(screen_map_pointer);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		if(screen_map_pointer >= screen_map_.size()) {
+			archive.invalidate();
+			return;
+		}
+		screen_map_pointer_ = screen_map_pointer;
+		initial_output_target_ = current_output_target_ = nullptr;
+	}
+}
+
 void VideoOutput::setup_base_address() {
 	switch(screen_mode_) {
 		case 0: case 1: case 2: screen_mode_base_address_ = 0x3000; break;
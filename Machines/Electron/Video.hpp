@@ -11,6 +11,7 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 #include "Interrupts.hpp"
 
 namespace Electron {
@@ -28,7 +29,7 @@ class VideoOutput {
 			Instantiates a VideoOutput that will read its pixels from @c memory. The pointer supplied
 			should be to address 0 in the unexpanded Electron's memory map.
 		*/
-		VideoOutput(uint8_t *memory);
+		VideoOutput(uint8_t *memory, Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL);
 
 		/// @returns the CRT to which output is being painted.
 		Outputs::CRT::CRT *get_crt();
@@ -74,6 +75,12 @@ class VideoOutput {
 		*/
 		Range get_memory_access_range();
 
+		/*!
+			Records or restores the video registers and raster position. Output resumes into a fresh
+			write area if restored mid-line.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
 		inline void start_pixel_line();
 		inline void end_pixel_line();
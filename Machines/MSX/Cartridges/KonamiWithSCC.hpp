@@ -80,6 +80,10 @@ class KonamiWithSCCROMSlotHandler: public ROMSlotHandler {
 			printf("KSCC");
 		}
 
+		void serialise(State::Archive &archive) override {
+			archive(scc_is_visible_);
+		}
+
 	private:
 		MSX::MemoryMap &map_;
 		int slot_;
@@ -66,6 +66,30 @@ void DiskROM::set_disk(std::shared_ptr<Storage::Disk::Disk> disk, size_t drive)
 	drives_[drive]->set_disk(disk);
 }
 
+void DiskROM::serialise(State::Archive &archive) {
+	archive.tag("MSXDiskROM");
+	WD1770::serialise(archive);
+	archive(controller_cycles_, selected_drive_, selected_head_);
+	if(selected_drive_ >= drives_.size()) {
+		archive.invalidate();
+		return;
+	}
+
+	for(auto &drive: drives_) {
+		bool has_drive = !!drive;
+		archive(has_drive);
+		if(has_drive != !!drive) {
+			archive.invalidate();
+			return;
+		}
+		if(drive) drive->serialise(archive);
+	}
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		set_drive(drives_[selected_drive_]);
+	}
+}
+
 void DiskROM::set_head_load_request(bool head_load) {
 	// Magic!
 	set_head_loaded(head_load);
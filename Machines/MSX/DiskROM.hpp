@@ -32,6 +32,9 @@ class DiskROM: public ROMSlotHandler, public WD::WD1770 {
 		void set_disk(std::shared_ptr<Storage::Disk::Disk> disk, size_t drive);
 		void set_activity_observer(Activity::Observer *observer);
 
+		/// Records or restores the WD1793, drive selection and both drives.
+		void serialise(State::Archive &archive) override;
+
 	private:
 		const std::vector<uint8_t> &rom_;
 
@@ -34,6 +34,7 @@
 #include "../CRTMachine.hpp"
 #include "../ConfigurationTarget.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../Outputs/Speaker/Implementation/CompoundSource.hpp"
 #include "../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
@@ -89,7 +90,8 @@ class ConcreteMachine:
 	public Configurable::Device,
 	public MemoryMap,
 	public Sleeper::SleepObserver,
-	public Activity::Source {
+	public Activity::Source,
+	public SnapshotMachine::Machine {
 	public:
 		ConcreteMachine():
 			z80_(*this),
@@ -119,7 +121,7 @@ class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override {
-			vdp_.reset(new TI::TMS9918(TI::TMS9918::TMS9918A));
+			vdp_.reset(new TI::TMS9918(TI::TMS9918::TMS9918A, get_output_backend()));
 		}
 
 		void close_output() override {
@@ -568,7 +570,70 @@ class ConcreteMachine:
 			}
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag("MSX");
+			z80_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			archive(paged_memory_, time_since_ay_update_, time_until_interrupt_, selected_key_line_, pc_address_);
+			if(selected_key_line_ & ~15) {
+				archive.invalidate();
+				return;
+			}
+
+			i8255_.serialise(archive);
+			vdp_->serialise(archive);
+			ay_.serialise(archive);
+			audio_toggle_.serialise(archive);
+			scc_.serialise(archive);
+			tape_player_.serialise(archive);
+
+			// Slot 3 is fixed to RAM; cartridge paging in the others is recorded relative to each slot's source.
+			for(std::size_t slot = 0; slot < 3; ++slot) {
+				auto &memory_slot = memory_slots_[slot];
+				for(auto &pointer: memory_slot.read_pointers) {
+					serialise_slot_pointer(archive, pointer, memory_slot.source);
+				}
+				archive(memory_slot.cycles_since_update);
+
+				bool has_handler = !!memory_slot.handler;
+				archive(has_handler);
+				if(has_handler != !!memory_slot.handler) {
+					archive.invalidate();
+					return;
+				}
+				if(memory_slot.handler) memory_slot.handler->serialise(archive);
+			}
+
+			if(!archive.is_saving() && archive.is_valid()) {
+				page_memory(paged_memory_);
+			}
+		}
+
 	private:
+		void serialise_slot_pointer(State::Archive &archive, uint8_t *&pointer, std::vector<uint8_t> &source) {
+			int32_t offset = -1;
+			if(pointer == unpopulated_) offset = -2;
+			else if(pointer) offset = static_cast<int32_t>(pointer - source.data());
+			archive(offset);
+			if(archive.is_saving() || !archive.is_valid()) return;
+
+			switch(offset) {
+				case -1:	pointer = nullptr;		break;
+				case -2:	pointer = unpopulated_;	break;
+				default:
+					if(offset < 0 || static_cast<std::size_t>(offset) >= source.size()) {
+						archive.invalidate();
+					} else {
+						pointer = &source[static_cast<std::size_t>(offset)];
+					}
+				break;
+			}
+		}
+
 		DiskROM *get_disk_rom() {
 			return dynamic_cast<DiskROM *>(memory_slots_[2].handler.get());
 		}
@@ -11,6 +11,7 @@
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
 #include "../../Analyser/Dynamic/ConfidenceCounter.hpp"
+#include "../../State/Archive.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -72,6 +73,12 @@ class ROMSlotHandler {
 		virtual void print_type() {
 		}
 
+		/*!
+			Records or restores any state held by the handler. Paging is applied via the MemoryMap,
+			so is recorded by its owner rather than here.
+		*/
+		virtual void serialise(State::Archive &archive) {}
+
 	protected:
 		Analyser::Dynamic::ConfidenceCounter confidence_counter_;
 };
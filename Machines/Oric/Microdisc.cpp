@@ -120,6 +120,35 @@ void Microdisc::run_for(const Cycles cycles) {
 	WD::WD1770::run_for(cycles);
 }
 
+void Microdisc::serialise(State::Archive &archive) {
+	archive.tag("Microdisc");
+	WD1770::serialise(archive);
+
+	const bool had_head_load_request = head_load_request_;
+	archive(selected_drive_, irq_enable_, paging_flags_, head_load_request_counter_, head_load_request_, last_control_);
+	if(selected_drive_ >= drives_.size()) {
+		archive.invalidate();
+		return;
+	}
+
+	for(auto &drive: drives_) {
+		bool has_drive = !!drive;
+		archive(has_drive);
+		if(has_drive != !!drive) {
+			archive.invalidate();
+			return;
+		}
+		if(drive) drive->serialise(archive);
+	}
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		set_drive(drives_[selected_drive_]);
+		if(observer_ && had_head_load_request != head_load_request_) {
+			observer_->set_led_status("Microdisc", head_load_request_);
+		}
+	}
+}
+
 bool Microdisc::get_drive_is_ready() {
 	return true;
 }
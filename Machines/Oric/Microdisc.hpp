@@ -44,6 +44,9 @@ class Microdisc: public WD::WD1770 {
 
 		void set_activity_observer(Activity::Observer *observer);
 
+		/// Records or restores the WD1793, the control register, head-load timing and all attached drives.
+		void serialise(State::Archive &archive);
+
 	private:
 		void set_control_register(uint8_t control, uint8_t changes);
 		void set_head_load_request(bool head_load);
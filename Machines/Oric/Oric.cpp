@@ -16,6 +16,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../Utility/MemoryFuzzer.hpp"
 #include "../Utility/StringSerialiser.hpp"
@@ -87,6 +88,12 @@ class Keyboard {
 			return !!(rows_[row_] & column_mask);
 		}
 
+		/// Records or restores the active row.
+		void serialise(State::Archive &archive) {
+			archive(row_);
+			row_ &= 7;
+		}
+
 	private:
 		uint8_t row_ = 0;
 		uint8_t rows_[8];
@@ -176,6 +183,11 @@ class VIAPortHandler: public MOS::MOS6522::IRQDelegatePortHandler {
 			audio_queue_.perform();
 		}
 
+		/// Records or restores the AY control lines; the AY itself is serialised by its owner.
+		void serialise(State::Archive &archive) {
+			archive(ay_bdir_, ay_bc1_);
+		}
+
 	private:
 		void update_ay() {
 			speaker_.run_for(audio_queue_, cycles_since_ay_update_.flush());
@@ -202,6 +214,7 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 	public Storage::Tape::BinaryTapePlayer::Delegate,
 	public Microdisc::Delegate,
 	public Activity::Source,
+	public SnapshotMachine::Machine,
 	public Machine {
 
 	public:
@@ -373,8 +386,10 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 			} else {
 				if((address & 0xff00) == 0x0300) {
 					if(address < 0x0310 || (disk_interface == Analyser::Static::Oric::Target::DiskInterface::None)) {
+						update_via();
 						if(isReadOperation(operation)) *value = via_.get_register(address);
 						else via_.set_register(address, *value);
+						via_sequence_point_ = via_.get_next_sequence_point();
 					} else {
 						switch(disk_interface) {
 							default: break;
@@ -431,7 +446,9 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 				if(!string_serialiser_->advance()) string_serialiser_.reset();
 			}
 
-			via_.run_for(Cycles(1));
+			// The VIA is run only when accessed, or when it might next change its interrupt output.
+			time_since_via_update_ += Cycles(1);
+			if(time_since_via_update_ >= via_sequence_point_) update_via();
 			via_port_handler_.run_for(Cycles(1));
 			tape_player_.run_for(Cycles(1));
 			switch(disk_interface) {
@@ -445,6 +462,7 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 
 		forceinline void flush() {
 			update_video();
+			update_via();
 			via_port_handler_.flush();
 			if(disk_interface == Analyser::Static::Oric::Target::DiskInterface::Pravetz) update_diskii();
 		}
@@ -453,7 +471,7 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 		void setup_output(float aspect_ratio) override final {
 			speaker_.set_input_rate(1000000.0f);
 
-			video_output_.reset(new VideoOutput(ram_));
+			video_output_.reset(new VideoOutput(ram_, get_output_backend()));
 			if(!colour_rom_.empty()) video_output_->set_colour_rom(colour_rom_);
 			set_video_signal(Outputs::CRT::VideoSignal::RGB);
 		}
@@ -482,7 +500,9 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 		// to satisfy Storage::Tape::BinaryTapePlayer::Delegate
 		void tape_did_change_input(Storage::Tape::BinaryTapePlayer *tape_player) override final {
 			// set CB1
+			update_via();
 			via_.set_control_line_input(MOS::MOS6522::Port::B, MOS::MOS6522::Line::One, !tape_player->get_input());
+			via_sequence_point_ = via_.get_next_sequence_point();
 		}
 
 		// for Utility::TypeRecipient::Delegate
@@ -561,6 +581,43 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 			}
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag("Oric");
+			m6502_.serialise(archive);
+			archive.bytes(ram_, sizeof(ram_));
+			archive(keyboard_read_count_, ram_top_);
+			if(ram_top_ < basic_visible_ram_top_) {
+				archive.invalidate();
+				return;
+			}
+
+			via_.serialise(archive);
+			via_port_handler_.serialise(archive);
+			keyboard_.serialise(archive);
+			ay8910_.serialise(archive);
+			tape_player_.serialise(archive);
+			video_output_->serialise(archive);
+
+			switch(disk_interface) {
+				default: break;
+				case Analyser::Static::Oric::Target::DiskInterface::Microdisc:
+					microdisc_.serialise(archive);
+					if(!archive.is_saving() && archive.is_valid()) microdisc_did_change_paging_flags(&microdisc_);
+				break;
+				case Analyser::Static::Oric::Target::DiskInterface::Pravetz:
+					diskii_.serialise(archive);
+					archive(pravetz_rom_base_pointer_);
+					if(pravetz_rom_base_pointer_ > 0x100) archive.invalidate();
+				break;
+			}
+
+			if(!archive.is_saving()) via_sequence_point_ = via_.get_next_sequence_point();
+		}
+
 	private:
 		const uint16_t basic_invisible_ram_top_ = 0xffff;
 		const uint16_t basic_visible_ram_top_ = 0xbfff;
@@ -596,6 +653,12 @@ template <Analyser::Static::Oric::Target::DiskInterface disk_interface> class Co
 
 		VIAPortHandler via_port_handler_;
 		MOS::MOS6522::MOS6522<VIAPortHandler> via_;
+		HalfCycles time_since_via_update_;
+		HalfCycles via_sequence_point_;
+		void update_via() {
+			via_.run_for(time_since_via_update_.flush());
+			via_sequence_point_ = via_.get_next_sequence_point();
+		}
 		Keyboard keyboard_;
 
 		// the Microdisc, if in use
@@ -17,11 +17,18 @@ namespace {
 	const unsigned int PAL60VSyncEndPosition = 238*64;
 	const unsigned int PAL50Period = 312*64;
 	const unsigned int PAL60Period = 262*64;
+
+	uint32_t software_rgb_sample(const uint8_t *sample, unsigned int) {
+		return
+			((sample[0] & 4) ? 0xff0000 : 0) |
+			((sample[0] & 2) ? 0x00ff00 : 0) |
+			((sample[0] & 1) ? 0x0000ff : 0);
+	}
 }
 
-VideoOutput::VideoOutput(uint8_t *memory) :
+VideoOutput::VideoOutput(uint8_t *memory, Outputs::CRT::OutputBackend backend) :
 		ram_(memory),
-		crt_(new Outputs::CRT::CRT(64*6, 6, Outputs::CRT::DisplayType::PAL50, 2)),
+		crt_(new Outputs::CRT::CRT(64*6, 6, Outputs::CRT::DisplayType::PAL50, 2, backend)),
 		v_sync_start_position_(PAL50VSyncStartPosition), v_sync_end_position_(PAL50VSyncEndPosition),
 		counter_period_(PAL50Period) {
 	crt_->set_rgb_sampling_function(
@@ -40,14 +47,16 @@ VideoOutput::VideoOutput(uint8_t *memory) :
 		"}"
 	);
 	crt_->set_composite_function_type(Outputs::CRT::CRT::CompositeSourceType::DiscreteFourSamplesPerCycle, 0.0f);
+	crt_->set_software_sampling_function(software_rgb_sample);
 
 	set_video_signal(Outputs::CRT::VideoSignal::Composite);
 	crt_->set_visible_area(crt_->get_rect_for_area(53, 224, 16 * 6, 40 * 6, 4.0f / 3.0f));
 }
 
 void VideoOutput::set_video_signal(Outputs::CRT::VideoSignal video_signal) {
-	video_signal_ = video_signal;
-	crt_->set_video_signal(video_signal);
+	// The software backend can't decode composite, so is always supplied with RGB data.
+	video_signal_ = (crt_->get_output_backend() == Outputs::CRT::OutputBackend::Software) ? Outputs::CRT::VideoSignal::RGB : video_signal;
+	crt_->set_video_signal(video_signal_);
 }
 
 void VideoOutput::set_colour_rom(const std::vector<uint8_t> &rom) {
@@ -218,6 +227,28 @@ void VideoOutput::run_for(const Cycles cycles) {
 	}
 }
 
+void VideoOutput::serialise(State::Archive &archive) {
+	archive.tag("OricVideo");
+	archive(counter_, frame_counter_, v_sync_start_position_, v_sync_end_position_, counter_period_);
+	archive(ink_, paper_, character_set_base_address_, is_graphics_mode_, next_frame_is_sixty_hertz_);
+	archive(use_alternative_character_set_, use_double_height_characters_, blink_text_);
+
+	if(!archive.is_saving() && archive.is_valid()) {
+		if(counter_period_ <= 0 || counter_ < 0 || counter_ >= counter_period_) {
+			archive.invalidate();
+			return;
+		}
+
+		// Resume a partially-drawn pixel line into a new write area.
+		const int h_counter = counter_ & 63;
+		pixel_target_ = nullptr;
+		if(counter_ < 224*64 && h_counter > 0 && h_counter < 40 && !(counter_ >= v_sync_start_position_ && counter_ < v_sync_end_position_)) {
+			pixel_target_ = reinterpret_cast<uint16_t *>(crt_->allocate_write_area(240));
+			if(pixel_target_) pixel_target_ += h_counter * 6;
+		}
+	}
+}
+
 void VideoOutput::set_character_set_base_address() {
 	if(is_graphics_mode_) character_set_base_address_ = use_alternative_character_set_ ? 0x9c00 : 0x9800;
 	else character_set_base_address_ = use_alternative_character_set_ ? 0xb800 : 0xb400;
@@ -11,17 +11,21 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace Oric {
 
 class VideoOutput {
 	public:
-		VideoOutput(uint8_t *memory);
+		VideoOutput(uint8_t *memory, Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL);
 		Outputs::CRT::CRT *get_crt();
 		void run_for(const Cycles cycles);
 		void set_colour_rom(const std::vector<uint8_t> &rom);
 		void set_video_signal(Outputs::CRT::VideoSignal output_device);
 
+		/// Records or restores the raster position and serial attribute state.
+		void serialise(State::Archive &archive);
+
 	private:
 		uint8_t *ram_;
 		std::unique_ptr<Outputs::CRT::CRT> crt_;
@@ -0,0 +1,69 @@
+//
+//  SnapshotMachine.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "SnapshotMachine.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace SnapshotMachine;
+
+namespace {
+
+/// Identifies a snapshot file, and the version of the container and of the serialisation conventions within it.
+const char FileSignature[] = {'C', 'L', 'K', 'S', 'T', 'A', 'T', 'E'};
+const uint8_t FileVersion = 1;
+
+}
+
+std::vector<uint8_t> Machine::get_state() {
+	State::Archive archive;
+	serialise(archive);
+	return archive.get_data();
+}
+
+bool Machine::set_state(const std::vector<uint8_t> &state) {
+	State::Archive archive(state);
+	serialise(archive);
+	return archive.is_valid() && archive.is_complete();
+}
+
+bool SnapshotMachine::WriteState(const std::vector<uint8_t> &state, const std::string &file_name) {
+	FILE *const file = std::fopen(file_name.c_str(), "wb");
+	if(!file) return false;
+
+	bool did_succeed =
+		std::fwrite(FileSignature, 1, sizeof(FileSignature), file) == sizeof(FileSignature) &&
+		std::fputc(FileVersion, file) != EOF &&
+		std::fwrite(state.data(), 1, state.size(), file) == state.size();
+	did_succeed &= !std::fclose(file);
+	return did_succeed;
+}
+
+bool SnapshotMachine::ReadState(const std::string &file_name, std::vector<uint8_t> &state) {
+	FILE *const file = std::fopen(file_name.c_str(), "rb");
+	if(!file) return false;
+
+	char signature[sizeof(FileSignature)];
+	if(	std::fread(signature, 1, sizeof(signature), file) != sizeof(signature) ||
+		std::memcmp(signature, FileSignature, sizeof(signature)) ||
+		std::fgetc(file) != FileVersion) {
+		std::fclose(file);
+		return false;
+	}
+
+	const long start = std::ftell(file);
+	std::fseek(file, 0, SEEK_END);
+	const long end = std::ftell(file);
+	std::fseek(file, start, SEEK_SET);
+
+	state.resize(static_cast<std::size_t>(end - start));
+	const bool did_succeed = std::fread(state.data(), 1, state.size(), file) == state.size();
+	std::fclose(file);
+	return did_succeed;
+}
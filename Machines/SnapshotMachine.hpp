@@ -0,0 +1,76 @@
+//
+//  SnapshotMachine.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef SnapshotMachine_hpp
+#define SnapshotMachine_hpp
+
+#include "../State/Archive.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SnapshotMachine {
+
+/*!
+	A SnapshotMachine::Machine is one whose complete emulated state — processor, support chips,
+	memory and media positions — can be captured and later restored, either in memory or via a file.
+
+	Output state is not included: the CRT will resynchronise to a restored machine, and any audio
+	buffered for output is unaffected. Neither is media content; a snapshot should be restored only to
+	a machine that was constructed for the same target and that has the same media inserted.
+*/
+class Machine {
+	public:
+		/*!
+			Records the machine's state into, or restores it from, @c archive. Implementations should
+			begin with a call to @c archive.tag so that state recorded for a different machine is rejected
+			before anything is restored.
+		*/
+		virtual void serialise(State::Archive &archive) = 0;
+
+		/// @returns A snapshot of the machine's current state.
+		std::vector<uint8_t> get_state();
+
+		/*!
+			Restores the machine to the state captured in @c state.
+
+			@returns @c true on success; @c false if @c state was not recorded by a compatible machine. If the
+				failure was detected only after restoration had begun then the machine's state is undefined
+				and it should be reset or restored from another snapshot.
+		*/
+		bool set_state(const std::vector<uint8_t> &state);
+
+		/*!
+			Creates a new machine in exactly the same state as this one, with the same configuration selections
+			and media. Memory is shared between the two and copied a page at a time only as either writes to it, so
+			the cost of a fork is proportional to the memory subsequently dirtied rather than to the machine's size.
+
+			Media is shared rather than copied, and tapes and disks each have a single position and set of contents;
+			so after a fork only one of the two machines should go on to play a tape or write to a disk.
+
+			The new machine has no output set up; callers should do so before running it.
+
+			At present only the Amstrad CPC keeps its memory in a form that can be shared, so only it can be forked.
+
+			@returns The new machine, or @c nullptr if this machine cannot be forked.
+		*/
+		virtual Machine *fork() {
+			return nullptr;
+		}
+};
+
+/*! Writes @c state to @c file_name. @returns @c true on success; @c false otherwise. */
+bool WriteState(const std::vector<uint8_t> &state, const std::string &file_name);
+
+/*! Reads a state previously written by @c WriteState from @c file_name. @returns @c true on success; @c false otherwise. */
+bool ReadState(const std::string &file_name, std::vector<uint8_t> &state);
+
+}
+
+#endif /* SnapshotMachine_hpp */
@@ -0,0 +1,97 @@
+//
+//  CopyOnWritePages.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef CopyOnWritePages_hpp
+#define CopyOnWritePages_hpp
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Memory {
+
+/*!
+	Provides a fixed number of pages of memory, each @c PageSize bytes long, that can be shared between
+	several owners and which are duplicated only when an owner needs to write to them.
+
+	Pages become shared via @c share_with. Thereafter a page is shared until an owner calls @c make_private
+	for it, which copies the page if anybody else still holds it. Owners must write only to private pages
+	and should re-fetch any page pointers they hold after calling @c make_private, as the page may have moved.
+
+	A shared page is never modified, so owners may run on different threads.
+*/
+template <std::size_t PageSize> class CopyOnWritePages {
+	public:
+		/// Constructs an empty set of pages, to be populated via another set's @c share_with.
+		CopyOnWritePages() {}
+
+		CopyOnWritePages(std::size_t number_of_pages) {
+			pages_.reserve(number_of_pages);
+			for(std::size_t c = 0; c < number_of_pages; ++c) {
+				pages_.emplace_back(new Page);
+			}
+		}
+
+		/// @returns The number of pages.
+		std::size_t size() const {
+			return pages_.size();
+		}
+
+		/// @returns A pointer to the start of page @c index, which may be read but should be written to only if @c is_private(index).
+		uint8_t *page(std::size_t index) {
+			return pages_[index]->data;
+		}
+
+		/// @returns @c true if page @c index is held only by this owner, and therefore may be written to; @c false otherwise.
+		bool is_private(std::size_t index) const {
+			return pages_[index].use_count() == 1;
+		}
+
+		/// Ensures that page @c index is held only by this owner, copying it if necessary. @returns A pointer to the start of the page.
+		uint8_t *make_private(std::size_t index) {
+			if(!is_private(index)) {
+				pages_[index].reset(new Page(*pages_[index]));
+			}
+			return page(index);
+		}
+
+		/*!
+			Replaces all of @c target's pages, if any, with this set's, marking all of them as shared.
+			No page is allocated or copied.
+		*/
+		void share_with(CopyOnWritePages &target) {
+			target.pages_ = pages_;
+		}
+
+		/// @returns The number of pages currently held only by this owner; this is the memory cost of the owner.
+		std::size_t number_of_private_pages() const {
+			std::size_t result = 0;
+			for(std::size_t c = 0; c < pages_.size(); ++c) {
+				if(is_private(c)) ++result;
+			}
+			return result;
+		}
+
+		/// Records or restores the contents of all pages; restoring makes every page private.
+		template <typename ArchiveT> void serialise(ArchiveT &archive) {
+			for(std::size_t c = 0; c < pages_.size(); ++c) {
+				archive.bytes(archive.is_saving() ? page(c) : make_private(c), PageSize);
+			}
+		}
+
+	private:
+		struct Page {
+			uint8_t data[PageSize];
+		};
+		std::vector<std::shared_ptr<Page>> pages_;
+};
+
+}
+
+#endif /* CopyOnWritePages_hpp */
@@ -49,6 +49,19 @@ template<typename T> class TypedDynamicMachine: public ::Machine::DynamicMachine
 			return get<Configurable::Device>();
 		}
 
+		SnapshotMachine::Machine *snapshot_machine() override {
+			return get<SnapshotMachine::Machine>();
+		}
+
+		DynamicMachine *fork() override {
+			SnapshotMachine::Machine *const machine = snapshot_machine();
+			if(!machine) return nullptr;
+
+			SnapshotMachine::Machine *const child = machine->fork();
+			if(!child) return nullptr;
+			return new TypedDynamicMachine<T>(dynamic_cast<T *>(child));
+		}
+
 		void *raw_pointer() override {
 			return get();
 		}
@@ -21,10 +21,14 @@ const std::size_t StandardAllocationSize = 40;
 /// The amount of time a byte takes to output.
 const std::size_t HalfCyclesPerByte = 8;
 
+uint32_t software_composite_sample(const uint8_t *sample, unsigned int icoordinate) {
+	return ((sample[0] << (icoordinate & 7)) & 128) ? 0xffffff : 0x000000;
 }
 
-Video::Video() :
-	crt_(new Outputs::CRT::CRT(207 * 2, 1, Outputs::CRT::DisplayType::PAL50, 1)) {
+}
+
+Video::Video(Outputs::CRT::OutputBackend backend) :
+	crt_(new Outputs::CRT::CRT(207 * 2, 1, Outputs::CRT::DisplayType::PAL50, 1, backend)) {
 
 	// Set a composite sampling function that assumes 1bpp input.
 	crt_->set_composite_sampling_function(
@@ -35,6 +39,7 @@ Video::Video() :
 			"return float(texValue & 128u);"
 		"}");
 	crt_->set_integer_coordinate_multiplier(8.0f);
+	crt_->set_software_sampling_function(software_composite_sample);
 
 	// Show only the centre 80% of the TV frame.
 	crt_->set_video_signal(Outputs::CRT::VideoSignal::Composite);
@@ -112,6 +117,14 @@ void Video::output_byte(uint8_t byte) {
 	}
 }
 
+void Video::serialise(State::Archive &archive) {
+	archive.tag("ZX8081Video");
+	archive(sync_, cycles_since_update_);
+	if(!archive.is_saving()) {
+		line_data_pointer_ = line_data_ = nullptr;
+	}
+}
+
 Outputs::CRT::CRT *Video::get_crt() {
 	return crt_.get();
 }
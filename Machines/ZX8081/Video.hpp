@@ -11,6 +11,7 @@
 
 #include "../../Outputs/CRT/CRT.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace ZX8081 {
 
@@ -27,7 +28,7 @@ namespace ZX8081 {
 class Video {
 	public:
 		/// Constructs an instance of the video feed; a CRT is also created.
-		Video();
+		Video(Outputs::CRT::OutputBackend backend = Outputs::CRT::OutputBackend::OpenGL);
 		/// @returns The CRT this video feed is feeding.
 		Outputs::CRT::CRT *get_crt();
 
@@ -41,6 +42,12 @@ class Video {
 		/// Causes @c byte to be serialised into pixels and output over the next four cycles.
 		void output_byte(uint8_t byte);
 
+		/*!
+			Records or restores the current sync level and output position. Pixels not yet
+			passed to the CRT are discarded upon restoration.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
 		bool sync_ = false;
 		uint8_t *line_data_ = nullptr;
@@ -11,6 +11,7 @@
 #include "../ConfigurationTarget.hpp"
 #include "../CRTMachine.hpp"
 #include "../KeyboardMachine.hpp"
+#include "../SnapshotMachine.hpp"
 
 #include "../../Components/AY38910/AY38910.hpp"
 #include "../../Processors/Z80/Z80.hpp"
@@ -64,6 +65,7 @@ template<bool is_zx81> class ConcreteMachine:
 	public Configurable::Device,
 	public Utility::TypeRecipient,
 	public CPU::Z80::BusHandler,
+	public SnapshotMachine::Machine,
 	public Machine {
 	public:
 		ConcreteMachine() :
@@ -262,7 +264,7 @@ template<bool is_zx81> class ConcreteMachine:
 		}
 
 		void setup_output(float aspect_ratio) override final {
-			video_.reset(new Video);
+			video_.reset(new Video(get_output_backend()));
 		}
 
 		void close_output() override final {
@@ -432,6 +434,23 @@ template<bool is_zx81> class ConcreteMachine:
 			return selection_set;
 		}
 
+		// MARK: - SnapshotMachine::Machine
+		void serialise(State::Archive &archive) override {
+			flush();
+			audio_queue_.flush();
+
+			archive.tag(is_zx81 ? "ZX81" : "ZX80");
+			z80_.serialise(archive);
+			archive.contents(ram_);
+			archive(vsync_, hsync_, line_counter_, nmi_is_enabled_);
+			archive(horizontal_counter_, latched_video_byte_, has_latched_video_byte_, tape_advance_delay_);
+			archive(time_since_ay_update_);
+
+			video_->serialise(archive);
+			tape_player_.serialise(archive);
+			ay_.serialise(archive);
+		}
+
 	private:
 		CPU::Z80::Processor<ConcreteMachine, false, is_zx81> z80_;
 
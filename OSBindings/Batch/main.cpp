@@ -0,0 +1,448 @@
+//
+//  main.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../Analyser/Static/AnalysisCache.hpp"
+#include "../../Analyser/Static/StaticAnalyser.hpp"
+#include "../../Machines/Utility/MachineForTarget.hpp"
+
+#include "../../Machines/ConfigurationTarget.hpp"
+#include "../../Machines/CRTMachine.hpp"
+#include "../../Machines/KeyboardMachine.hpp"
+
+namespace {
+
+/// The amount of emulated time to run between checks for scripted input and frame captures.
+constexpr double StepLength = 0.01;
+
+/// Collects all audio produced by the machine, for output as a WAV file.
+struct SpeakerDelegate: public Outputs::Speaker::Speaker::Delegate {
+	static const int buffer_size = 1024;
+	static const int output_rate = 44100;
+
+	void speaker_did_complete_samples(Outputs::Speaker::Speaker *speaker, const std::vector<int16_t> &buffer) override {
+		std::lock_guard<std::mutex> lock_guard(audio_buffer_mutex_);
+		audio_buffer_.insert(audio_buffer_.end(), buffer.begin(), buffer.end());
+	}
+
+	std::mutex audio_buffer_mutex_;
+	std::vector<int16_t> audio_buffer_;
+};
+
+/// A single scripted keyboard event: at @c time seconds of emulated time, @c text is typed.
+struct ScriptedInput {
+	double time;
+	std::string text;
+};
+
+struct ParsedArguments {
+	std::string file_name;
+	Configurable::SelectionSet selections;
+
+	double duration = 10.0;
+	double frame_interval = 0.0;
+	unsigned int frame_width = 640, frame_height = 480;
+	std::string output_directory = ".";
+	std::string wav_file_name;
+	std::string cache_directory;
+	std::vector<ScriptedInput> script;
+};
+
+/*! Expands the escape sequences \n, \t, \\ and \s (space) within @c text. */
+std::string unescape(const std::string &text) {
+	std::string result;
+	for(std::size_t index = 0; index < text.size(); ++index) {
+		if(text[index] != '\\' || index == text.size() - 1) {
+			result.push_back(text[index]);
+			continue;
+		}
+
+		++index;
+		switch(text[index]) {
+			case 'n':	result.push_back('\n');	break;
+			case 't':	result.push_back('\t');	break;
+			case 's':	result.push_back(' ');	break;
+			default:	result.push_back(text[index]);	break;
+		}
+	}
+	return result;
+}
+
+/*!
+	Reads a keyboard script from @c file_name. Each line should consist of an emulated time in seconds,
+	a single space and then the text to type at that time; see @c unescape for supported escape sequences.
+	Blank lines and lines starting with # are ignored.
+
+	@returns @c true if the script was read successfully; @c false otherwise.
+*/
+bool read_script(const std::string &file_name, std::vector<ScriptedInput> &script) {
+	FILE *const file = std::fopen(file_name.c_str(), "r");
+	if(!file) return false;
+
+	char line[1024];
+	while(std::fgets(line, sizeof(line), file)) {
+		std::string text = line;
+		while(!text.empty() && (text.back() == '\n' || text.back() == '\r')) text.pop_back();
+		if(text.empty() || text[0] == '#') continue;
+
+		const std::size_t split_index = text.find(' ');
+		if(split_index == std::string::npos) continue;
+
+		ScriptedInput input;
+		input.time = std::atof(text.substr(0, split_index).c_str());
+		input.text = unescape(text.substr(split_index + 1));
+		script.push_back(input);
+	}
+	std::fclose(file);
+
+	std::stable_sort(script.begin(), script.end(), [](const ScriptedInput &lhs, const ScriptedInput &rhs) {
+		return lhs.time < rhs.time;
+	});
+	return true;
+}
+
+/*! Parses an argc/argv pair to discern program arguments. */
+ParsedArguments parse_arguments(int argc, char *argv[]) {
+	ParsedArguments arguments;
+
+	for(int index = 1; index < argc; ++index) {
+		char *arg = argv[index];
+
+		// Accepted format is as per the SDL binding:
+		//
+		//	--flag			sets a Boolean option to true.
+		//	--flag=value	sets the value for a list option.
+		//	name			sets the file name to load.
+		//
+		// Options that are meaningful to this runner are removed; all others are offered to the machine.
+		if(arg[0] == '-') {
+			while(*arg == '-') arg++;
+
+			// Check for an equals sign, to discern a Boolean selection from a list selection.
+			std::string argument = arg;
+			std::size_t split_index = argument.find("=");
+
+			if(split_index == std::string::npos) {
+				arguments.selections[argument] =  std::unique_ptr<Configurable::Selection>(new Configurable::BooleanSelection(true));
+			} else {
+				std::string name = argument.substr(0, split_index);
+				std::string value = argument.substr(split_index+1, std::string::npos);
+
+				if(name == "duration")		arguments.duration = std::atof(value.c_str());
+				else if(name == "frames")	arguments.frame_interval = std::atof(value.c_str());
+				else if(name == "width")	arguments.frame_width = static_cast<unsigned int>(std::atoi(value.c_str()));
+				else if(name == "height")	arguments.frame_height = static_cast<unsigned int>(std::atoi(value.c_str()));
+				else if(name == "output")	arguments.output_directory = value;
+				else if(name == "wav")		arguments.wav_file_name = value;
+				else if(name == "cache")	arguments.cache_directory = value;
+				else if(name == "type") {
+					ScriptedInput input;
+					input.time = 0.0;
+					input.text = unescape(value);
+					arguments.script.insert(arguments.script.begin(), input);
+				} else if(name == "script") {
+					if(!read_script(value, arguments.script)) {
+						std::cerr << "Could not read script " << value << std::endl;
+					}
+				} else {
+					arguments.selections[name] =  std::unique_ptr<Configurable::Selection>(new Configurable::ListSelection(value));
+				}
+			}
+		} else {
+			arguments.file_name = arg;
+		}
+	}
+
+	return arguments;
+}
+
+std::string final_path_component(const std::string &path) {
+	// An empty path has no final component.
+	if(path.empty()) {
+		return "";
+	}
+
+	// Find the last slash...
+	auto final_slash = path.find_last_of("/\\");
+
+	// If no slash was found at all, return the whole path.
+	if(final_slash == std::string::npos) {
+		return path;
+	}
+
+	// If a slash was found in the final position, remove it and recurse.
+	if(final_slash == path.size() - 1) {
+		return final_path_component(path.substr(0, path.size() - 1));
+	}
+
+	// Otherwise return everything from just after the slash to the end of the path.
+	return path.substr(final_slash+1, path.size() - final_slash - 1);
+}
+
+/*! Writes @c frame to @c file_name as a binary PPM. @returns @c true on success; @c false otherwise. */
+bool write_frame(const Outputs::CRT::SoftwareFrame &frame, const std::string &file_name) {
+	FILE *const file = std::fopen(file_name.c_str(), "wb");
+	if(!file) return false;
+
+	std::fprintf(file, "P6\n%u %u\n255\n", frame.width, frame.height);
+	const std::size_t written = std::fwrite(frame.pixels.data(), 1, frame.pixels.size(), file);
+	std::fclose(file);
+	return written == frame.pixels.size();
+}
+
+void write_uint16(FILE *file, uint16_t value) {
+	std::fputc(value & 0xff, file);
+	std::fputc(value >> 8, file);
+}
+
+void write_uint32(FILE *file, uint32_t value) {
+	write_uint16(file, static_cast<uint16_t>(value));
+	write_uint16(file, static_cast<uint16_t>(value >> 16));
+}
+
+/*! Writes @c samples to @c file_name as a 16-bit mono WAV. @returns @c true on success; @c false otherwise. */
+bool write_wav(const std::vector<int16_t> &samples, int rate, const std::string &file_name) {
+	FILE *const file = std::fopen(file_name.c_str(), "wb");
+	if(!file) return false;
+
+	const uint32_t data_size = static_cast<uint32_t>(samples.size() * sizeof(int16_t));
+
+	std::fputs("RIFF", file);
+	write_uint32(file, 36 + data_size);
+	std::fputs("WAVE", file);
+
+	std::fputs("fmt ", file);
+	write_uint32(file, 16);								// Chunk size.
+	write_uint16(file, 1);								// Format: PCM.
+	write_uint16(file, 1);								// Channels.
+	write_uint32(file, static_cast<uint32_t>(rate));	// Sample rate.
+	write_uint32(file, static_cast<uint32_t>(rate * 2));	// Byte rate.
+	write_uint16(file, 2);								// Block alignment.
+	write_uint16(file, 16);								// Bits per sample.
+
+	std::fputs("data", file);
+	write_uint32(file, data_size);
+	for(const auto sample: samples) {
+		write_uint16(file, static_cast<uint16_t>(sample));
+	}
+
+	const bool did_succeed = !std::ferror(file);
+	std::fclose(file);
+	return did_succeed;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	// Attempt to parse arguments.
+	ParsedArguments arguments = parse_arguments(argc, argv);
+
+	// Print a help message if requested, or if no file was specified.
+	const bool wants_help = arguments.selections.find("help") != arguments.selections.end() || arguments.selections.find("h") != arguments.selections.end();
+	if(wants_help || arguments.file_name.empty()) {
+		(wants_help ? std::cout : std::cerr) << "Usage: " << final_path_component(argv[0]) << " [file] [OPTIONS]" << std::endl;
+		if(!wants_help) return -1;
+
+		std::cout << "Runs the machine appropriate to the file, as quickly as possible and without any user interface." << std::endl << std::endl;
+		std::cout << "\t--duration=[seconds]\tthe amount of emulated time to run for; defaults to 10" << std::endl;
+		std::cout << "\t--frames=[seconds]\tthe emulated interval between frame snapshots; if omitted, only a final frame is written" << std::endl;
+		std::cout << "\t--width=[pixels], --height=[pixels]\tthe dimensions of frame snapshots; defaults to 640x480" << std::endl;
+		std::cout << "\t--output=[directory]\tthe directory to which frame snapshots are written; defaults to the current directory" << std::endl;
+		std::cout << "\t--wav=[file]\t\twrites all audio output to the named WAV file" << std::endl;
+		std::cout << "\t--type=[text]\t\ttypes the text immediately; \\n, \\t, \\s and \\\\ are expanded" << std::endl;
+		std::cout << "\t--script=[file]\t\ttypes text at scripted times; each line should be '[seconds] [text]'" << std::endl;
+		std::cout << "\t--timings\t\tprints the time taken by each static analyser to stderr" << std::endl;
+		std::cout << "\t--cache=[directory]\tkeeps the results of static analysis in the named directory, for reuse" << std::endl;
+		std::cout << std::endl << "Any other options are passed to the machine, as per the SDL binding." << std::endl;
+		return 0;
+	}
+
+	// Determine the machine for the supplied file.
+	std::vector<Analyser::Static::AnalyserTiming> timings;
+	const bool wants_timings = arguments.selections.find("timings") != arguments.selections.end();
+	std::unique_ptr<Analyser::Static::AnalysisCache> analysis_cache;
+	if(!arguments.cache_directory.empty()) analysis_cache.reset(new Analyser::Static::AnalysisCache(arguments.cache_directory));
+	Analyser::Static::TargetList targets = Analyser::Static::GetTargets(arguments.file_name, wants_timings ? &timings : nullptr, analysis_cache.get());
+	for(const auto &timing: timings) {
+		std::cerr << timing.name << ": " << std::fixed << std::setprecision(2) << timing.seconds * 1000.0 << "ms, " << timing.number_of_targets << " target(s)" << std::endl;
+	}
+	if(targets.empty()) {
+		std::cerr << "Cannot open " << arguments.file_name << "; no target machine found" << std::endl;
+		return -1;
+	}
+
+	// As per the SDL binding, assume system ROMs can be found in one of:
+	//
+	//	/usr/local/share/CLK/[system]; or
+	//	/usr/share/CLK/[system]
+	std::vector<std::string> rom_names;
+	std::string machine_name;
+	ROMMachine::ROMFetcher rom_fetcher = [&rom_names, &machine_name]
+		(const std::string &machine, const std::vector<std::string> &names) -> std::vector<std::unique_ptr<std::vector<uint8_t>>> {
+			rom_names.insert(rom_names.end(), names.begin(), names.end());
+			machine_name = machine;
+
+			std::vector<std::unique_ptr<std::vector<uint8_t>>> results;
+			for(const auto &name: names) {
+				std::string local_path = "/usr/local/share/CLK/" + machine + "/" + name;
+				FILE *file = std::fopen(local_path.c_str(), "rb");
+				if(!file) {
+					std::string path = "/usr/share/CLK/" + machine + "/" + name;
+					file = std::fopen(path.c_str(), "rb");
+				}
+
+				if(!file) {
+					results.emplace_back(nullptr);
+					continue;
+				}
+
+				std::unique_ptr<std::vector<uint8_t>> data(new std::vector<uint8_t>);
+
+				std::fseek(file, 0, SEEK_END);
+				data->resize(std::ftell(file));
+				std::fseek(file, 0, SEEK_SET);
+				std::size_t read = fread(data->data(), 1, data->size(), file);
+				std::fclose(file);
+
+				if(read == data->size())
+					results.emplace_back(std::move(data));
+				else
+					results.emplace_back(nullptr);
+			}
+
+			return results;
+		};
+
+	// Create and configure a machine.
+	::Machine::Error error;
+	std::unique_ptr<::Machine::DynamicMachine> machine(::Machine::MachineForTargets(targets, rom_fetcher, error));
+	if(!machine) {
+		switch(error) {
+			default: break;
+			case ::Machine::Error::MissingROM:
+				std::cerr << "Could not find system ROMs; please install to /usr/local/share/CLK/ or /usr/share/CLK/." << std::endl;
+				std::cerr << "One or more of the following were needed but not found:" << std::endl;
+				for(const auto &name: rom_names) {
+					std::cerr << machine_name << '/' << name << std::endl;
+				}
+			break;
+		}
+
+		return -1;
+	}
+
+	// Set up output, without an OpenGL context.
+	CRTMachine::Machine *const crt_machine = machine->crt_machine();
+	crt_machine->set_output_backend(Outputs::CRT::OutputBackend::Software);
+	crt_machine->setup_output(4.0f / 3.0f);
+	crt_machine->get_crt()->set_output_gamma(2.2f);
+
+	SpeakerDelegate speaker_delegate;
+	auto speaker = crt_machine->get_speaker();
+	if(speaker && !arguments.wav_file_name.empty()) {
+		speaker->set_output_rate(SpeakerDelegate::output_rate, SpeakerDelegate::buffer_size);
+		speaker->set_delegate(&speaker_delegate);
+	}
+
+	// Establish user-friendly options by default.
+	Configurable::Device *configurable_device = machine->configurable_device();
+	if(configurable_device) {
+		configurable_device->set_selections(configurable_device->get_user_friendly_selections());
+
+		// Consider transcoding any list selections that map to Boolean options.
+		for(const auto &option: configurable_device->get_options()) {
+			// Check for a corresponding selection.
+			auto selection = arguments.selections.find(option->short_name);
+			if(selection != arguments.selections.end()) {
+				// Transcode selection if necessary.
+				if(dynamic_cast<Configurable::BooleanOption *>(option.get())) {
+					arguments.selections[selection->first] =  std::unique_ptr<Configurable::Selection>(selection->second->boolean_selection());
+				}
+
+				if(dynamic_cast<Configurable::ListOption *>(option.get())) {
+					arguments.selections[selection->first] =  std::unique_ptr<Configurable::Selection>(selection->second->list_selection());
+				}
+			}
+		}
+		configurable_device->set_selections(arguments.selections);
+	}
+
+	KeyboardMachine::Machine *const keyboard_machine = machine->keyboard_machine();
+	if(!arguments.script.empty() && !keyboard_machine) {
+		std::cerr << "Scripted input will be ignored; this machine has no keyboard" << std::endl;
+	}
+
+	// Run for the requested duration, as quickly as possible, drawing after every step so that the CRT never
+	// accumulates more than a step's worth of output.
+	auto script_iterator = arguments.script.begin();
+	const unsigned int frame_width = arguments.frame_width;
+	const unsigned int frame_height = arguments.frame_height;
+	double time = 0.0;
+	double next_frame_time = arguments.frame_interval;
+	int frames_written = 0;
+
+	const auto start_time = std::chrono::steady_clock::now();
+	while(time < arguments.duration) {
+		while(script_iterator != arguments.script.end() && script_iterator->time <= time) {
+			if(keyboard_machine) keyboard_machine->type_string(script_iterator->text);
+			++script_iterator;
+		}
+
+		const double step = std::min(StepLength, arguments.duration - time);
+		crt_machine->run_for(step);
+		time += step;
+		crt_machine->get_crt()->draw_frame(frame_width, frame_height, false);
+
+		if(arguments.frame_interval > 0.0 && time >= next_frame_time) {
+			std::stringstream file_name;
+			file_name << arguments.output_directory << "/frame-" << std::setfill('0') << std::setw(6) << frames_written << ".ppm";
+			if(!write_frame(*crt_machine->get_crt()->get_software_frame(), file_name.str())) {
+				std::cerr << "Could not write " << file_name.str() << std::endl;
+				return -1;
+			}
+			++frames_written;
+			next_frame_time += arguments.frame_interval;
+		}
+	}
+	const double real_time = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::steady_clock::now() - start_time).count();
+
+	// If no periodic snapshots were requested, write only the final frame.
+	if(arguments.frame_interval <= 0.0) {
+		const std::string file_name = arguments.output_directory + "/frame.ppm";
+		if(!write_frame(*crt_machine->get_crt()->get_software_frame(), file_name)) {
+			std::cerr << "Could not write " << file_name << std::endl;
+			return -1;
+		}
+	}
+
+	// Destroying the machine ensures that all audio is complete.
+	machine.reset();
+	if(!arguments.wav_file_name.empty()) {
+		if(!speaker) {
+			std::cerr << "No audio written; this machine has no speaker" << std::endl;
+		} else if(!write_wav(speaker_delegate.audio_buffer_, SpeakerDelegate::output_rate, arguments.wav_file_name)) {
+			std::cerr << "Could not write " << arguments.wav_file_name << std::endl;
+			return -1;
+		}
+	}
+
+	std::cout << "Ran " << time << " emulated seconds in " << real_time << " real seconds (" << (time / real_time) << "x)" << std::endl;
+	return 0;
+}
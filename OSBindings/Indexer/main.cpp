@@ -0,0 +1,372 @@
+//
+//  main.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "../../Analyser/Static/AnalysisCache.hpp"
+#include "../../Analyser/Static/StaticAnalyser.hpp"
+#include "../../Machines/Utility/MachineForTarget.hpp"
+
+#include "../../Analyser/Static/Acorn/Disk.hpp"
+#include "../../Analyser/Static/Acorn/Tape.hpp"
+#include "../../Analyser/Static/Acorn/Target.hpp"
+#include "../../Analyser/Static/AmstradCPC/StaticAnalyser.hpp"
+#include "../../Analyser/Static/AmstradCPC/Target.hpp"
+#include "../../Analyser/Static/Commodore/Disk.hpp"
+#include "../../Analyser/Static/Commodore/Tape.hpp"
+#include "../../Analyser/Static/Commodore/Target.hpp"
+#include "../../Analyser/Static/MSX/Target.hpp"
+#include "../../Analyser/Static/Oric/Target.hpp"
+#include "../../Analyser/Static/ZX8081/Target.hpp"
+#include "../../Storage/Disk/Parsers/CPM.hpp"
+
+#include "../../Concurrency/ThreadPool.hpp"
+
+namespace {
+
+struct ParsedArguments {
+	std::vector<std::string> paths;
+	std::string output_file_name;
+	std::string cache_directory;
+	std::size_t number_of_threads = 0;
+	bool wants_help = false;
+	bool include_hidden = false;
+};
+
+/*! Parses an argc/argv pair to discern program arguments. */
+ParsedArguments parse_arguments(int argc, char *argv[]) {
+	ParsedArguments arguments;
+
+	for(int index = 1; index < argc; ++index) {
+		char *arg = argv[index];
+
+		// Accepted format is as per the batch runner:
+		//
+		//	--flag			sets a Boolean option to true.
+		//	--flag=value	sets the value for a list option.
+		//	name			adds a file or directory to index.
+		if(arg[0] == '-') {
+			while(*arg == '-') arg++;
+
+			std::string argument = arg;
+			std::size_t split_index = argument.find("=");
+
+			if(split_index == std::string::npos) {
+				if(argument == "help" || argument == "h")	arguments.wants_help = true;
+				else if(argument == "hidden")				arguments.include_hidden = true;
+				else std::cerr << "Unrecognised option --" << argument << std::endl;
+			} else {
+				std::string name = argument.substr(0, split_index);
+				std::string value = argument.substr(split_index+1, std::string::npos);
+
+				if(name == "output")		arguments.output_file_name = value;
+				else if(name == "cache")	arguments.cache_directory = value;
+				else if(name == "threads")	arguments.number_of_threads = static_cast<std::size_t>(std::atoi(value.c_str()));
+				else std::cerr << "Unrecognised option --" << name << std::endl;
+			}
+		} else {
+			arguments.paths.push_back(arg);
+		}
+	}
+
+	return arguments;
+}
+
+std::string final_path_component(const std::string &path) {
+	// An empty path has no final component.
+	if(path.empty()) {
+		return "";
+	}
+
+	// Find the last slash...
+	auto final_slash = path.find_last_of("/\\");
+
+	// If no slash was found at all, return the whole path.
+	if(final_slash == std::string::npos) {
+		return path;
+	}
+
+	// If a slash was found in the final position, remove it and recurse.
+	if(final_slash == path.size() - 1) {
+		return final_path_component(path.substr(0, path.size() - 1));
+	}
+
+	// Otherwise return everything from just after the slash to the end of the path.
+	return path.substr(final_slash+1, path.size() - final_slash - 1);
+}
+
+/*!
+	Appends to @c files every regular file at or below @c path. Directories already visited, as identified by
+	device and inode, are skipped so that symbolic links can't cause a loop.
+*/
+void gather_files(const std::string &path, bool include_hidden, std::set<std::pair<dev_t, ino_t>> &visited_directories, std::vector<std::string> &files) {
+	struct stat file_stats;
+	if(stat(path.c_str(), &file_stats)) {
+		std::cerr << "Cannot inspect " << path << std::endl;
+		return;
+	}
+
+	if(S_ISREG(file_stats.st_mode)) {
+		files.push_back(path);
+		return;
+	}
+	if(!S_ISDIR(file_stats.st_mode)) return;
+	if(!visited_directories.insert(std::make_pair(file_stats.st_dev, file_stats.st_ino)).second) return;
+
+	DIR *const directory = opendir(path.c_str());
+	if(!directory) {
+		std::cerr << "Cannot open directory " << path << std::endl;
+		return;
+	}
+
+	std::vector<std::string> entries;
+	while(struct dirent *const entry = readdir(directory)) {
+		const std::string name = entry->d_name;
+		if(name == "." || name == "..") continue;
+		if(!include_hidden && name[0] == '.') continue;
+		entries.push_back(name);
+	}
+	closedir(directory);
+
+	// Sort so that the index is in a predictable order.
+	std::sort(entries.begin(), entries.end());
+	const std::string prefix = (path.back() == '/') ? path : path + "/";
+	for(const auto &entry: entries) {
+		gather_files(prefix + entry, include_hidden, visited_directories, files);
+	}
+}
+
+/*! Escapes tabs, newlines, carriage returns and backslashes within @c text, so that it can form a single field. */
+std::string escape(const std::string &text) {
+	std::string result;
+	for(const char c: text) {
+		switch(c) {
+			case '\t':	result += "\\t";	break;
+			case '\n':	result += "\\n";	break;
+			case '\r':	result += "\\r";	break;
+			case '\\':	result += "\\\\";	break;
+			default:	result.push_back(c);	break;
+		}
+	}
+	return result;
+}
+
+/*! @returns @c text without any trailing spaces, which fixed-width catalogue entries tend to be padded with. */
+std::string trimmed(std::string text) {
+	while(!text.empty() && text.back() == ' ') text.pop_back();
+	return text;
+}
+
+/*! Encodes @c text, such as a PETSCII file name that has been mapped to Unicode, as UTF-8. */
+std::string utf8(const std::wstring &text) {
+	std::string result;
+	for(const wchar_t character: text) {
+		const uint32_t code_point = static_cast<uint32_t>(character);
+		if(code_point < 0x80) {
+			result.push_back(static_cast<char>(code_point));
+		} else if(code_point < 0x800) {
+			result.push_back(static_cast<char>(0xc0 | (code_point >> 6)));
+			result.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+		} else if(code_point < 0x10000) {
+			result.push_back(static_cast<char>(0xe0 | (code_point >> 12)));
+			result.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+			result.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+		} else {
+			result.push_back(static_cast<char>(0xf0 | (code_point >> 18)));
+			result.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3f)));
+			result.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3f)));
+			result.push_back(static_cast<char>(0x80 | (code_point & 0x3f)));
+		}
+	}
+	return result;
+}
+
+/*! @returns The command that @c target will type in order to load its software, if any. */
+std::string loading_command(const Analyser::Static::Target &target) {
+#define Command(ns)	\
+	if(const auto derived = dynamic_cast<const Analyser::Static::ns::Target *>(&target)) return derived->loading_command;
+	Command(Acorn);
+	Command(AmstradCPC);
+	Command(Commodore);
+	Command(MSX);
+	Command(Oric);
+	Command(ZX8081);
+#undef Command
+	return "";
+}
+
+/*!
+	@returns The names of the files on the disks and tapes of @c target, for those machines with a file
+	system that the static analysers are able to read.
+*/
+std::vector<std::string> file_listing(const Analyser::Static::Target &target) {
+	std::vector<std::string> names;
+
+	switch(target.machine) {
+		default: break;
+
+		case Analyser::Machine::Electron:
+			for(const auto &disk: target.media.disks) {
+				std::unique_ptr<Analyser::Static::Acorn::Catalogue> catalogue = Analyser::Static::Acorn::GetDFSCatalogue(disk);
+				if(!catalogue) catalogue = Analyser::Static::Acorn::GetADFSCatalogue(disk);
+				if(!catalogue) continue;
+				for(const auto &file: catalogue->files) names.push_back(trimmed(file.name));
+			}
+			for(const auto &tape: target.media.tapes) {
+				tape->reset();
+				for(const auto &file: Analyser::Static::Acorn::GetFiles(tape)) names.push_back(trimmed(file.name));
+				tape->reset();
+			}
+		break;
+
+		case Analyser::Machine::Vic20:
+			for(const auto &disk: target.media.disks) {
+				for(const auto &file: Analyser::Static::Commodore::GetFiles(disk)) names.push_back(trimmed(utf8(file.name)));
+			}
+			for(const auto &tape: target.media.tapes) {
+				tape->reset();
+				for(const auto &file: Analyser::Static::Commodore::GetFiles(tape)) names.push_back(trimmed(utf8(file.name)));
+				tape->reset();
+			}
+		break;
+
+		case Analyser::Machine::AmstradCPC: {
+			// Try the data format first and then the system format, as per the CPC analyser.
+			const Storage::Disk::CPM::ParameterBlock data_format = Analyser::Static::AmstradCPC::DataFormat();
+			const Storage::Disk::CPM::ParameterBlock system_format = Analyser::Static::AmstradCPC::SystemFormat();
+
+			for(const auto &disk: target.media.disks) {
+				std::unique_ptr<Storage::Disk::CPM::Catalogue> catalogue = Storage::Disk::CPM::GetCatalogue(disk, data_format);
+				if(!catalogue) catalogue = Storage::Disk::CPM::GetCatalogue(disk, system_format);
+				if(!catalogue) continue;
+				for(const auto &file: catalogue->files) {
+					const std::string name = trimmed(file.name);
+					const std::string type = trimmed(file.type);
+					names.push_back(type.empty() ? name : name + "." + type);
+				}
+			}
+		} break;
+	}
+
+	return names;
+}
+
+/*! @returns The index lines for @c file_name: one per target, each terminated by a newline. */
+std::string index_file(const std::string &file_name, Analyser::Static::AnalysisCache *cache) {
+	std::string lines;
+	const Analyser::Static::TargetList targets = Analyser::Static::GetTargets(file_name, nullptr, cache);
+
+	for(const auto &target: targets) {
+		char confidence[16];
+		std::snprintf(confidence, sizeof(confidence), "%.2f", target->confidence);
+
+		lines += escape(file_name);
+		lines += '\t';
+		lines += Machine::ShortNameForTargetMachine(target->machine);
+		lines += '\t';
+		lines += confidence;
+		lines += '\t';
+		lines += escape(loading_command(*target));
+		for(const auto &name: file_listing(*target)) {
+			lines += '\t';
+			lines += escape(name);
+		}
+		lines += '\n';
+	}
+
+	return lines;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	// Attempt to parse arguments.
+	ParsedArguments arguments = parse_arguments(argc, argv);
+
+	// Print a help message if requested, or if nothing was specified to index.
+	if(arguments.wants_help || arguments.paths.empty()) {
+		(arguments.wants_help ? std::cout : std::cerr) << "Usage: " << final_path_component(argv[0]) << " [files or directories] [OPTIONS]" << std::endl;
+		if(!arguments.wants_help) return -1;
+
+		std::cout << "Analyses every file within the named directories, in parallel, and writes an index of those that can be run." << std::endl << std::endl;
+		std::cout << "Each line of the index describes one potential target, as tab-separated fields: the file name, the machine," << std::endl;
+		std::cout << "the analyser's confidence from 0 to 1, the loading command and then the names of any files found on the media." << std::endl;
+		std::cout << "Tabs, newlines, carriage returns and backslashes within fields are written as \\t, \\n, \\r and \\\\." << std::endl << std::endl;
+		std::cout << "\t--output=[file]\t\twrites the index to the named file rather than to stdout" << std::endl;
+		std::cout << "\t--threads=[count]\tthe number of files to analyse at once; defaults to one per core" << std::endl;
+		std::cout << "\t--cache=[directory]\tkeeps the results of static analysis in the named directory, for reuse" << std::endl;
+		std::cout << "\t--hidden\t\talso indexes files and directories with names that begin with a full stop" << std::endl;
+		return 0;
+	}
+
+	// Find everything to index.
+	std::vector<std::string> files;
+	std::set<std::pair<dev_t, ino_t>> visited_directories;
+	for(const auto &path: arguments.paths) {
+		gather_files(path, arguments.include_hidden, visited_directories, files);
+	}
+
+	std::unique_ptr<Analyser::Static::AnalysisCache> analysis_cache;
+	if(!arguments.cache_directory.empty()) analysis_cache.reset(new Analyser::Static::AnalysisCache(arguments.cache_directory));
+
+	// Analyse everything. Results are kept per file so that the index is written in a predictable order
+	// regardless of which files finish first.
+	std::vector<std::string> lines(files.size());
+	const auto analyse = [&files, &lines, &analysis_cache] (std::size_t index) {
+		// A single malformed file shouldn't cost the whole index; note it and move on. Not everything thrown
+		// is a std::exception (some parsers throw enums) so anything else is caught too.
+		try {
+			lines[index] = index_file(files[index], analysis_cache.get());
+		} catch(const std::exception &exception) {
+			std::cerr << "Could not analyse " << files[index] << ": " << exception.what() << std::endl;
+		} catch(...) {
+			std::cerr << "Could not analyse " << files[index] << std::endl;
+		}
+	};
+	if(arguments.number_of_threads == 1) {
+		for(std::size_t c = 0; c < files.size(); ++c) analyse(c);
+	} else {
+		// parallel_for also puts this thread to work, so one fewer worker is needed than the number of threads requested.
+		Concurrency::ThreadPool thread_pool(arguments.number_of_threads ? arguments.number_of_threads - 1 : 0);
+		thread_pool.parallel_for(files.size(), analyse);
+	}
+
+	// Write the index.
+	std::ofstream output_file;
+	if(!arguments.output_file_name.empty()) {
+		output_file.open(arguments.output_file_name);
+		if(!output_file) {
+			std::cerr << "Cannot write to " << arguments.output_file_name << std::endl;
+			return -1;
+		}
+	}
+	std::ostream &output = arguments.output_file_name.empty() ? std::cout : output_file;
+
+	std::size_t indexed_files = 0;
+	for(const auto &file_lines: lines) {
+		output << file_lines;
+		if(!file_lines.empty()) ++indexed_files;
+	}
+	output.flush();
+
+	std::cerr << "Indexed " << indexed_files << " of " << files.size() << " file(s)" << std::endl;
+	return 0;
+}
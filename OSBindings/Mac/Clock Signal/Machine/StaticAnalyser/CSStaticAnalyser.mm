@@ -11,6 +11,7 @@
 #import "CSMachine.h"
 #import "CSMachine+Target.h"
 
+#include "AnalysisCache.hpp"
 #include "StaticAnalyser.hpp"
 
 #include "../../../../../Analyser/Static/Acorn/Target.hpp"
@@ -27,10 +28,24 @@
 	Analyser::Static::TargetList _targets;
 }
 
++ (Analyser::Static::AnalysisCache *)analysisCache {
+	static Analyser::Static::AnalysisCache *cache;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		// Keep analyses in the user's caches directory, if one can be created.
+		NSURL *cachesURL = [[NSFileManager defaultManager] URLForDirectory:NSCachesDirectory inDomain:NSUserDomainMask appropriateForURL:nil create:YES error:nil];
+		NSURL *analysisURL = [cachesURL URLByAppendingPathComponent:@"Analysis" isDirectory:YES];
+		if(analysisURL && [[NSFileManager defaultManager] createDirectoryAtURL:analysisURL withIntermediateDirectories:YES attributes:nil error:nil]) {
+			cache = new Analyser::Static::AnalysisCache(analysisURL.fileSystemRepresentation);
+		}
+	});
+	return cache;
+}
+
 - (instancetype)initWithFileAtURL:(NSURL *)url {
 	self = [super init];
 	if(self) {
-		_targets = Analyser::Static::GetTargets([url fileSystemRepresentation]);
+		_targets = Analyser::Static::GetTargets([url fileSystemRepresentation], nullptr, [CSStaticAnalyser analysisCache]);
 		if(!_targets.size()) return nil;
 
 		// TODO: could this better be supplied by the analyser? A hypothetical file format might
@@ -183,7 +198,7 @@ static Analyser::Static::ZX8081::Target::MemoryModel ZX8081MemoryModelFromSize(K
 
 - (NSString *)optionsPanelNibName {
 	switch(_targets.front()->machine) {
-		case Analyser::Machine::AmstradCPC:	return nil;
+		case Analyser::Machine::AmstradCPC:	return @"QuickLoadOptions";
 		case Analyser::Machine::Atari2600:	return @"Atari2600Options";
 		case Analyser::Machine::Electron:	return @"QuickLoadCompositeOptions";
 		case Analyser::Machine::MSX:		return @"QuickLoadCompositeOptions";
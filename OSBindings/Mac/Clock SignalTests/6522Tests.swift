@@ -105,6 +105,49 @@ class MOS6522Tests: XCTestCase {
 		}
 	}
 
+	func testSequencePoint() {
+		with6522 {
+			// set timer 1 to a value of $0010 and enable its interrupt
+			$0.setValue(16, forRegister: 4)
+			$0.setValue(0, forRegister: 5)
+			$0.setValue(0x40 | 0x80, forRegister: 14)
+
+			// complete the cycle to set initial values
+			$0.run(forHalfCycles: 2)
+
+			// the timer should predict its own interrupt, and that prediction should be exact
+			let sequencePoint = $0.nextSequencePoint
+			XCTAssert(sequencePoint == 35, "Interrupt should be predicted 35 half-cycles from now; was \(sequencePoint)")
+
+			$0.run(forHalfCycles: sequencePoint - 1)
+			XCTAssert(!$0.irqLine, "IRQ should not yet be active")
+
+			$0.run(forHalfCycles: 1)
+			XCTAssert($0.irqLine, "IRQ should be active")
+		}
+	}
+
+	func testBulkRunMatchesStepping() {
+		let stepped = MOS6522Bridge()
+		let bulk = MOS6522Bridge()
+		for via in [stepped, bulk] {
+			// set timer 1 to free run from $0123 and timer 2 to count down from $0456
+			via.setValue(0x40, forRegister: 11)
+			via.setValue(0x23, forRegister: 4)
+			via.setValue(0x01, forRegister: 5)
+			via.setValue(0x56, forRegister: 8)
+			via.setValue(0x04, forRegister: 9)
+		}
+
+		for _ in 0 ..< 10001 {
+			stepped.run(forHalfCycles: 1)
+		}
+		bulk.run(forHalfCycles: 10001)
+
+		for register: UInt in [4, 5, 8, 9, 13] {
+			XCTAssert(stepped.value(forRegister: register) == bulk.value(forRegister: register), "Register \(register) should not depend on how the 6522 was run")
+		}
+	}
 
 	// MARK: Data direction tests
 	func testDataDirection() {
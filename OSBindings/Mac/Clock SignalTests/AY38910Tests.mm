@@ -0,0 +1,153 @@
+//
+//  AY38910Tests.m
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/AY38910/AY38910.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+@interface AY38910Tests : XCTestCase
+@end
+
+@implementation AY38910Tests {
+	std::unique_ptr<Concurrency::DeferringAsyncTaskQueue> _queue;
+	std::unique_ptr<GI::AY38910::AY38910> _ay;
+}
+
+- (void)setUp
+{
+	[super setUp];
+	[self resetAY];
+}
+
+- (void)resetAY
+{
+	_ay.reset();
+	_queue.reset(new Concurrency::DeferringAsyncTaskQueue);
+	_ay.reset(new GI::AY38910::AY38910(*_queue));
+	_ay->set_sample_volume_range(32767);
+}
+
+- (void)tearDown
+{
+	_ay.reset();
+	_queue.reset();
+	[super tearDown];
+}
+
+- (void)writeRegister:(uint8_t)reg value:(uint8_t)value
+{
+	_ay->set_control_lines(GI::AY38910::ControlLines(GI::AY38910::BDIR | GI::AY38910::BC2 | GI::AY38910::BC1));
+	_ay->set_data_input(reg);
+	_ay->set_control_lines(GI::AY38910::ControlLines(GI::AY38910::BDIR | GI::AY38910::BC2));
+	_ay->set_data_input(value);
+	_ay->set_control_lines(GI::AY38910::ControlLines(0));
+
+	_queue->perform();
+	_queue->flush();
+}
+
+/// Programs channel A for a tone, channel B for noise and channel C to follow the envelope, all at short periods.
+- (void)setUpAllGenerators
+{
+	[self writeRegister:0 value:37];
+	[self writeRegister:6 value:3];
+	[self writeRegister:7 value:0x2e];
+	[self writeRegister:8 value:15];
+	[self writeRegister:9 value:11];
+	[self writeRegister:10 value:0x10];
+	[self writeRegister:11 value:5];
+	[self writeRegister:13 value:10];
+}
+
+- (void)testTonePeriod
+{
+	[self writeRegister:0 value:10];
+	[self writeRegister:7 value:0x3e];
+	[self writeRegister:8 value:15];
+
+	std::vector<int16_t> samples(8192);
+	_ay->get_samples(samples.size(), samples.data());
+
+	// The tone counter is clocked once every eight samples and toggles output upon reaching zero,
+	// so output should change every 8 * (10 + 1) samples.
+	std::size_t last_change = 0;
+	int changes = 0;
+	for(std::size_t c = 1; c < samples.size(); ++c) {
+		if(samples[c] != samples[c-1]) {
+			if(changes) XCTAssertEqual(c - last_change, std::size_t(88), @"Output should change every 88 samples");
+			last_change = c;
+			++changes;
+		}
+	}
+	XCTAssertGreaterThan(changes, 80);
+}
+
+- (void)testOutputIsIndependentOfRequestSize
+{
+	// Generate the same output once in large requests and once in a mixture of tiny ones; enabling the
+	// noise generator and the envelope only part way through ensures that they have been correctly
+	// advanced while inaudible.
+	std::vector<int16_t> whole(40000), pieces(40000);
+	const std::size_t midpoint = 15003;
+
+	[self writeRegister:0 value:37];
+	[self writeRegister:6 value:3];
+	[self writeRegister:7 value:0x3e];
+	[self writeRegister:8 value:15];
+	[self writeRegister:11 value:5];
+	[self writeRegister:13 value:10];
+	_ay->get_samples(midpoint, whole.data());
+	[self writeRegister:7 value:0x2e];
+	[self writeRegister:9 value:11];
+	[self writeRegister:10 value:0x10];
+	_ay->get_samples(whole.size() - midpoint, &whole[midpoint]);
+
+	[self resetAY];
+	[self writeRegister:0 value:37];
+	[self writeRegister:6 value:3];
+	[self writeRegister:7 value:0x3e];
+	[self writeRegister:8 value:15];
+	[self writeRegister:11 value:5];
+	[self writeRegister:13 value:10];
+	std::size_t c = 0;
+	std::size_t length = 1;
+	while(c < pieces.size()) {
+		if(c == midpoint) {
+			[self writeRegister:7 value:0x2e];
+			[self writeRegister:9 value:11];
+			[self writeRegister:10 value:0x10];
+		}
+
+		const std::size_t next = std::min(c + length, (c < midpoint) ? midpoint : pieces.size());
+		_ay->get_samples(next - c, &pieces[c]);
+		c = next;
+		length = (length * 7) % 23 + 1;
+	}
+
+	XCTAssert(whole == pieces, @"Output should not depend on the size of sample requests");
+}
+
+- (void)testSampleGenerationPerformance
+{
+	[self setUpAllGenerators];
+
+	std::vector<int16_t> samples(1024);
+	int16_t *const target = samples.data();
+	GI::AY38910::AY38910 *const ay = _ay.get();
+	[self measureBlock:^{
+		for(int c = 0; c < 10000; ++c) {
+			ay->get_samples(1024, target);
+		}
+	}];
+}
+
+@end
@@ -0,0 +1,142 @@
+//
+//  DiskIITests.m
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/DiskII/DiskII.hpp"
+#include "../../../Storage/Disk/DiskImage/DiskImage.hpp"
+#include "../../../Storage/Disk/DiskImage/Formats/NIB.hpp"
+#include "../../../State/Archive.hpp"
+#include "CSROMFetcher.hpp"
+
+#include <memory>
+#include <vector>
+
+@interface DiskIITests : XCTestCase
+@end
+
+@implementation DiskIITests {
+	std::vector<uint8_t> _stateMachine;
+	std::unique_ptr<Apple::DiskII> _diskII;
+}
+
+- (void)setUp
+{
+	[super setUp];
+
+	// The Disk II's state machine ROM is copyright Apple so may not be present; if it isn't then
+	// there's nothing to test.
+	auto roms = CSROMFetcher()("DiskII", {"state-machine-16.rom"});
+	if(!roms[0]) return;
+
+	_stateMachine = *roms[0];
+	_diskII = [self makeDiskII];
+}
+
+/// @returns A Disk II with Nibbles.nib inserted into drive 1, which is selected, spinning and in read mode.
+- (std::unique_ptr<Apple::DiskII>)makeDiskII
+{
+	NSString *diskPath = [[[[NSBundle bundleForClass:[self class]] resourcePath] stringByAppendingPathComponent:@"Disk Images"] stringByAppendingPathComponent:@"Nibbles.nib"];
+
+	std::unique_ptr<Apple::DiskII> diskII(new Apple::DiskII);
+	diskII->set_state_machine(_stateMachine);
+	diskII->set_disk(std::make_shared<Storage::Disk::DiskImageHolder<Storage::Disk::NIB>>(diskPath.UTF8String), 0);
+
+	// Select drive 1, start the motor and enter read mode.
+	diskII->get_register(0xa);
+	diskII->get_register(0x9);
+	diskII->get_register(0xe);
+	return diskII;
+}
+
+/// @returns The serialised state of @c diskII, including that of its drives.
+- (std::vector<uint8_t>)stateOf:(Apple::DiskII &)diskII
+{
+	State::Archive recorder;
+	diskII.serialise(recorder);
+	return recorder.get_data();
+}
+
+/// Polls the data latch as a typical read loop would, at 2Mhz; @returns the number of times
+/// a complete 0xd5 nibble was seen.
+- (int)readForCycles:(int)cycles
+{
+	int prologues = 0;
+	for(int c = 0; c < cycles; c += 14) {
+		if(_diskII->get_register(0xc) == 0xd5) ++prologues;
+		_diskII->run_for(Cycles(14));
+	}
+	return prologues;
+}
+
+- (void)testReadsNibbles
+{
+	if(!_diskII) return;
+	XCTAssert([self readForCycles:2045454] > 0, @"Should have read at least one address prologue in a second of spinning");
+}
+
+- (void)testBatchedMatchesStepped
+{
+	if(!_diskII) return;
+
+	// Give the second controller an exact copy of the first's state, including the drive's
+	// random source, so that both should proceed identically.
+	std::unique_ptr<Apple::DiskII> steppedDiskII = [self makeDiskII];
+	State::Archive restorer([self stateOf:*_diskII]);
+	steppedDiskII->serialise(restorer);
+	XCTAssert(restorer.is_complete(), @"Stepped controller should accept the batched controller's state");
+
+	// Poll the latch for a second of spinning, running one controller in 14-cycle batches and the other
+	// cycle by cycle; occasionally load the data register or step the head so as to pass over
+	// different tracks, and periodically compare complete state, which includes the data register,
+	// shift register and head position.
+	int phase = 0;
+	for(int poll = 0; poll < 2045454 / 14; ++poll) {
+		if(poll % 5000 == 4999) {
+			for(auto diskII: {_diskII.get(), steppedDiskII.get()}) {
+				diskII->get_register(1 + 2*((phase + 1)&3));
+				diskII->get_register(2*(phase&3));
+			}
+			++phase;
+		}
+		if(poll % 777 == 0) {
+			_diskII->set_register(0xd, static_cast<uint8_t>(poll));
+			steppedDiskII->set_register(0xd, static_cast<uint8_t>(poll));
+		}
+
+		const uint8_t batched = _diskII->get_register(0xc);
+		const uint8_t stepped = steppedDiskII->get_register(0xc);
+		if(batched != stepped) {
+			XCTFail(@"Latch differs at poll %d: %02x when batched versus %02x when stepped", poll, batched, stepped);
+			return;
+		}
+
+		_diskII->run_for(Cycles(14));
+		for(int c = 0; c < 14; ++c) steppedDiskII->run_for(Cycles(1));
+
+		if(!(poll % 1000) && [self stateOf:*_diskII] != [self stateOf:*steppedDiskII]) {
+			XCTFail(@"State differs after poll %d", poll);
+			return;
+		}
+	}
+
+	// Also compare a single long run against the same number of single steps.
+	_diskII->run_for(Cycles(500000));
+	for(int c = 0; c < 500000; ++c) steppedDiskII->run_for(Cycles(1));
+	XCTAssert([self stateOf:*_diskII] == [self stateOf:*steppedDiskII], @"State should be identical after a long run");
+}
+
+- (void)testReadThroughput
+{
+	if(!_diskII) return;
+	[self measureBlock:^{
+		[self readForCycles:2045454 * 20];
+	}];
+}
+
+@end
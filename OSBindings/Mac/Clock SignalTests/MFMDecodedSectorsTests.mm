@@ -0,0 +1,110 @@
+//
+//  MFMDecodedSectorsTests.m
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Storage/Disk/Encodings/MFM/Constants.hpp"
+#include "../../../Storage/Disk/Encodings/MFM/Encoder.hpp"
+#include "../../../Storage/Disk/Encodings/MFM/SegmentParser.hpp"
+#include "../../../Storage/Disk/Track/PCMPatchedTrack.hpp"
+#include "../../../Storage/Disk/Track/TrackSerialiser.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+@interface MFMDecodedSectorsTests : XCTestCase
+@end
+
+@implementation MFMDecodedSectorsTests
+
+#pragma mark - Prebuilt sectors
+
+- (std::vector<Storage::Encodings::MFM::Sector>)sectorsWithSize:(uint8_t)size {
+	std::vector<Storage::Encodings::MFM::Sector> sectors;
+	srand(256);
+
+	for(uint8_t c = 0; c < 9; ++c) {
+		sectors.emplace_back();
+		Storage::Encodings::MFM::Sector &sector = sectors.back();
+		sector.address.track = 3;
+		sector.address.side = 1;
+		sector.address.sector = c + 1;
+		sector.size = size;
+		sector.is_deleted = c == 4;
+
+		// Leave one sector without data, and supply another with too little.
+		if(c == 2) continue;
+		sector.samples.emplace_back();
+		const std::size_t length = static_cast<std::size_t>((128 << size) - ((c == 6) ? 17 : 0));
+		for(std::size_t b = 0; b < length; ++b) {
+			sector.samples[0].push_back(static_cast<uint8_t>(rand()));
+		}
+	}
+
+	return sectors;
+}
+
+#pragma mark - Tests
+
+/*!
+	Checks that the sectors published by @c track are those that would be found by parsing it. Positions are
+	compared only if @c compare_positions is set, since they'll differ for tracks not of the nominal length.
+*/
+- (void)compareDecodedSectorsOfTrack:(Storage::Disk::Track &)track isDoubleDensity:(bool)is_double_density comparePositions:(bool)compare_positions {
+	XCTAssert(track.get_decoded_sectors(), @"Track built from sectors should publish them");
+
+	const auto decoded = Storage::Encodings::MFM::sectors_from_track(track, is_double_density);
+	const auto parsed = Storage::Encodings::MFM::sectors_from_segment(
+		Storage::Disk::track_serialisation(track, is_double_density ? Storage::Encodings::MFM::MFMBitLength : Storage::Encodings::MFM::FMBitLength),
+		is_double_density);
+
+	XCTAssertEqual(decoded.size(), parsed.size(), @"Decoded and parsed tracks should contain the same number of sectors");
+	auto decoded_iterator = decoded.begin();
+	auto parsed_iterator = parsed.begin();
+	while(decoded_iterator != decoded.end() && parsed_iterator != parsed.end()) {
+		if(compare_positions) {
+			XCTAssertEqual(decoded_iterator->first, parsed_iterator->first, @"Sectors should be found at the same position");
+		}
+		XCTAssertEqual(decoded_iterator->second.address.sector, parsed_iterator->second.address.sector);
+		XCTAssertEqual(decoded_iterator->second.size, parsed_iterator->second.size);
+		XCTAssertEqual(decoded_iterator->second.is_deleted, parsed_iterator->second.is_deleted);
+		XCTAssert(decoded_iterator->second.samples == parsed_iterator->second.samples, @"Sector %d should have the same contents", decoded_iterator->second.address.sector);
+		++decoded_iterator;
+		++parsed_iterator;
+	}
+}
+
+- (void)testMFMTrack {
+	auto track = Storage::Encodings::MFM::GetMFMTrackWithSectors([self sectorsWithSize:2]);
+	[self compareDecodedSectorsOfTrack:*track isDoubleDensity:true comparePositions:true];
+}
+
+- (void)testFMTrack {
+	auto track = Storage::Encodings::MFM::GetFMTrackWithSectors([self sectorsWithSize:1]);
+	[self compareDecodedSectorsOfTrack:*track isDoubleDensity:false comparePositions:true];
+}
+
+- (void)testTruncatedTrack {
+	// Nine 1kb sectors won't fit on a single MFM track, so the final sectors should be absent.
+	auto track = Storage::Encodings::MFM::GetMFMTrackWithSectors([self sectorsWithSize:3]);
+	[self compareDecodedSectorsOfTrack:*track isDoubleDensity:true comparePositions:false];
+}
+
+- (void)testWrongDensity {
+	auto track = Storage::Encodings::MFM::GetMFMTrackWithSectors([self sectorsWithSize:2]);
+	XCTAssert(Storage::Encodings::MFM::sectors_from_track(*track, false).empty(), @"An MFM track should contain no FM sectors");
+}
+
+- (void)testPatchedTrack {
+	std::shared_ptr<Storage::Disk::Track> track = Storage::Encodings::MFM::GetMFMTrackWithSectors([self sectorsWithSize:2]);
+	Storage::Disk::PCMPatchedTrack patched_track(track);
+	XCTAssert(!patched_track.get_decoded_sectors(), @"A patched track shouldn't publish the sectors of its original");
+}
+
+@end
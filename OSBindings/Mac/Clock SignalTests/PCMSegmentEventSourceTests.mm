@@ -110,4 +110,31 @@
 	XCTAssertTrue(next_event.type == Storage::Disk::Track::Event::IndexHole, @"End should have been reached");
 }
 
+- (void)testIndexedEventsMatchScannedEvents
+{
+	// Build a long segment with sparse and irregular transitions, and a partial final byte.
+	Storage::Disk::PCMSegment sparseSegment;
+	sparseSegment.data.resize(1000);
+	for(std::size_t c = 0; c < 7990; c += 1 + (c * 7) % 97) {
+		sparseSegment.data[c >> 3] |= 0x80 >> (c & 7);
+	}
+	sparseSegment.number_of_bits = 7990;
+	sparseSegment.length_of_a_bit.length = 1;
+	sparseSegment.length_of_a_bit.clock_rate = 7990;
+
+	// A seek causes the index to be built; prior to that, events are found by scanning.
+	Storage::Disk::PCMSegmentEventSource scannedSource(sparseSegment);
+	Storage::Disk::PCMSegmentEventSource indexedSource(sparseSegment);
+	indexedSource.seek_to(Storage::Time(0));
+
+	while(true) {
+		Storage::Disk::Track::Event scanned_event = scannedSource.get_next_event();
+		Storage::Disk::Track::Event indexed_event = indexedSource.get_next_event();
+
+		XCTAssertTrue(scanned_event.type == indexed_event.type, @"Event types should match");
+		XCTAssertTrue(scanned_event.length == indexed_event.length, @"Event lengths should match");
+		if(scanned_event.type == Storage::Disk::Track::Event::IndexHole || scanned_event.type != indexed_event.type) break;
+	}
+}
+
 @end
@@ -0,0 +1,102 @@
+//
+//  TapeCheckpointTests.m
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Storage/Tape/Formats/CommodoreTAP.hpp"
+#include "../../../Storage/Tape/Formats/CSW.hpp"
+#include "../../../Storage/Tape/Formats/TapeUEF.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+@interface TapeCheckpointTests : XCTestCase
+@end
+
+@implementation TapeCheckpointTests {
+	std::vector<Storage::Tape::Tape::Pulse> _pulses;
+	std::vector<Storage::Time> _times;
+}
+
+- (NSString *)pathForImage:(NSString *)name
+{
+	NSString *basePath = [[[NSBundle bundleForClass:[self class]] resourcePath] stringByAppendingPathComponent:@"Tape Images"];
+	return [basePath stringByAppendingPathComponent:name];
+}
+
+/// Plays the whole of @c tape once, recording what it produces and building its index as a side effect.
+- (void)recordTape:(Storage::Tape::Tape &)tape
+{
+	_pulses.clear();
+	_times.clear();
+
+	Storage::Time time(0);
+	_times.push_back(time);
+	while(!tape.is_at_end()) {
+		_pulses.push_back(tape.get_next_pulse());
+		time += _pulses.back().length;
+		_times.push_back(time);
+	}
+	XCTAssert(!_pulses.empty(), @"Tape should contain some pulses");
+}
+
+- (void)assertTape:(Storage::Tape::Tape &)tape producesPulsesFrom:(std::size_t)offset
+{
+	XCTAssertEqual(tape.get_offset(), offset);
+	XCTAssert(tape.get_current_time() == _times[offset], @"Time at offset %zu should be that of a linear playback", offset);
+	for(std::size_t c = offset; c < offset + 100 && c < _pulses.size(); ++c) {
+		const Storage::Tape::Tape::Pulse pulse = tape.get_next_pulse();
+		XCTAssertEqual(pulse.type, _pulses[c].type, @"Pulse %zu should be of the same type as in a linear playback", c);
+		XCTAssert(pulse.length == _pulses[c].length, @"Pulse %zu should be of the same length as in a linear playback", c);
+	}
+}
+
+/// Records @c tape, then checks that arbitrary calls to set_offset and seek land where a linear playback would.
+- (void)checkTape:(Storage::Tape::Tape &)tape
+{
+	[self recordTape:tape];
+
+	srand(2);
+	for(int c = 0; c < 200; ++c) {
+		const std::size_t offset = static_cast<std::size_t>(rand()) % _pulses.size();
+		tape.set_offset(offset);
+		[self assertTape:tape producesPulsesFrom:offset];
+	}
+
+	srand(3);
+	for(int c = 0; c < 200; ++c) {
+		// Seeking to the exact end of a pulse should land upon the pulse after.
+		const std::size_t offset = static_cast<std::size_t>(rand()) % (_pulses.size() - 1);
+		Storage::Time time = _times[offset];
+		tape.seek(time);
+		[self assertTape:tape producesPulsesFrom:offset + 1];
+	}
+}
+
+- (void)testCommodoreTAP
+{
+	Storage::Tape::CommodoreTAP tape([self pathForImage:@"Pulses.tap"].UTF8String);
+	[self checkTape:tape];
+}
+
+- (void)testZRLECSW
+{
+	// This is long enough that checkpoints will include copies of the inflater.
+	Storage::Tape::CSW tape([self pathForImage:@"ZRLE.csw"].UTF8String);
+	[self checkTape:tape];
+}
+
+- (void)testCompressedUEF
+{
+	// This is long enough that checkpoints will include copies of the inflater, and changes
+	// baud rate and time base part way through.
+	Storage::Tape::UEF tape([self pathForImage:@"Compressed.uef"].UTF8String);
+	[self checkTape:tape];
+}
+
+@end
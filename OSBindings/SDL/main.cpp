@@ -7,12 +7,14 @@
 //
 
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <memory>
 
 #include <SDL2/SDL.h>
 
+#include "../../Analyser/Static/AnalysisCache.hpp"
 #include "../../Analyser/Static/StaticAnalyser.hpp"
 #include "../../Machines/Utility/MachineForTarget.hpp"
 
@@ -36,6 +38,8 @@ struct SpeakerDelegate: public Outputs::Speaker::Speaker::Delegate {
 	static const int buffer_size = 1024;
 
 	void speaker_did_complete_samples(Outputs::Speaker::Speaker *speaker, const std::vector<int16_t> &buffer) override {
+		if(!updater->should_output_audio_buffer()) return;
+
 		std::lock_guard<std::mutex> lock_guard(audio_buffer_mutex_);
 		if(audio_buffer_.size() > buffer_size) {
 			audio_buffer_.erase(audio_buffer_.begin(), audio_buffer_.end() - buffer_size);
@@ -204,7 +208,9 @@ int main(int argc, char *argv[]) {
 	// Print a help message if requested.
 	if(arguments.selections.find("help") != arguments.selections.end() || arguments.selections.find("h") != arguments.selections.end()) {
 		std::cout << "Usage: " << final_path_component(argv[0]) << " [file] [OPTIONS]" << std::endl;
-		std::cout << "Use alt+enter to toggle full screen display. Use control+shift+V to paste text." << std::endl;
+		std::cout << "Use alt+enter to toggle full screen display. Use control+shift+V to paste text. Use control+shift+T to toggle turbo mode." << std::endl;
+		std::cout << "Use --turbo to start in turbo mode, and --speed=[multiplier] to cap the speed of turbo mode." << std::endl;
+		std::cout << "Use --cache=[directory] to keep the results of file analysis in the named directory, so that they needn't be repeated." << std::endl;
 		std::cout << "Required machine type and configuration is determined from the file. Machines with further options:" << std::endl << std::endl;
 
 		auto all_options = Machine::AllOptionsByMachineName();
@@ -238,8 +244,15 @@ int main(int argc, char *argv[]) {
 		return -1;
 	}
 
-	// Determine the machine for the supplied file.
-	Analyser::Static::TargetList targets = Analyser::Static::GetTargets(arguments.file_name);
+	// Determine the machine for the supplied file, consulting the analysis cache if one was nominated.
+	std::unique_ptr<Analyser::Static::AnalysisCache> analysis_cache;
+	auto cache = arguments.selections.find("cache");
+	if(cache != arguments.selections.end()) {
+		Configurable::ListSelection *const list_selection = dynamic_cast<Configurable::ListSelection *>(cache->second.get());
+		if(list_selection) analysis_cache.reset(new Analyser::Static::AnalysisCache(list_selection->value));
+		arguments.selections.erase(cache);
+	}
+	Analyser::Static::TargetList targets = Analyser::Static::GetTargets(arguments.file_name, nullptr, analysis_cache.get());
 	if(targets.empty()) {
 		std::cerr << "Cannot open " << arguments.file_name << "; no target machine found" << std::endl;
 		return -1;
@@ -313,6 +326,20 @@ int main(int argc, char *argv[]) {
 	speaker_delegate.updater = &updater;
 	updater.set_delegate(&best_effort_updater_delegate);
 
+	// Apply turbo settings, if any, removing them from the selections that will later be offered to the machine.
+	double turbo_multiplier = 0.0;
+	auto speed = arguments.selections.find("speed");
+	if(speed != arguments.selections.end()) {
+		Configurable::ListSelection *const list_selection = dynamic_cast<Configurable::ListSelection *>(speed->second.get());
+		if(list_selection) turbo_multiplier = std::atof(list_selection->value.c_str());
+		arguments.selections.erase(speed);
+	}
+	auto turbo = arguments.selections.find("turbo");
+	if(turbo != arguments.selections.end()) {
+		updater.set_turbo(true, turbo_multiplier);
+		arguments.selections.erase(turbo);
+	}
+
 	// Attempt to set up video and audio.
 	if(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
 		std::cerr << "SDL could not initialize! SDL_Error: " << SDL_GetError() << std::endl;
@@ -434,6 +461,12 @@ int main(int argc, char *argv[]) {
 						}
 					}
 
+					// Syphon off control+shift+T (toggle turbo).
+					if(event.key.keysym.sym == SDLK_t && (SDL_GetModState()&KMOD_CTRL) && (SDL_GetModState()&KMOD_SHIFT)) {
+						updater.set_turbo(!updater.get_is_turbo(), turbo_multiplier);
+						break;
+					}
+
 					// Also syphon off alt+enter (toggle full-screen).
 					if(event.key.keysym.sym == SDLK_RETURN && (SDL_GetModState()&KMOD_ALT)) {
 						fullscreen_mode ^= SDL_WINDOW_FULLSCREEN_DESKTOP;
@@ -484,10 +517,14 @@ int main(int argc, char *argv[]) {
 			}
 		}
 
-		// Display a new frame and wait for vsync.
+		// Display a new frame and wait for vsync, unless this frame is being skipped to allow turbo mode to proceed.
 		updater.update();
-		machine->crt_machine()->get_crt()->draw_frame(static_cast<unsigned int>(window_width), static_cast<unsigned int>(window_height), false);
-		SDL_GL_SwapWindow(window);
+		if(updater.should_draw_frame()) {
+			machine->crt_machine()->get_crt()->draw_frame(static_cast<unsigned int>(window_width), static_cast<unsigned int>(window_height), false);
+			SDL_GL_SwapWindow(window);
+		} else {
+			SDL_Delay(1);
+		}
 	}
 
 	// Clean up.
@@ -90,9 +90,9 @@ void CRT::update_gamma() {
 	openGL_output_builder_.set_gamma(gamma_ratio);
 }
 
-CRT::CRT(unsigned int common_output_divisor, unsigned int buffer_depth) :
+CRT::CRT(unsigned int common_output_divisor, unsigned int buffer_depth, OutputBackend backend) :
 	common_output_divisor_(common_output_divisor),
-	openGL_output_builder_(buffer_depth) {}
+	openGL_output_builder_(buffer_depth, backend) {}
 
 CRT::CRT(	unsigned int cycles_per_line,
 			unsigned int common_output_divisor,
@@ -101,13 +101,14 @@ CRT::CRT(	unsigned int cycles_per_line,
 			unsigned int colour_cycle_numerator, unsigned int colour_cycle_denominator,
 			unsigned int vertical_sync_half_lines,
 			bool should_alternate,
-			unsigned int buffer_depth) :
-		CRT(common_output_divisor, buffer_depth) {
+			unsigned int buffer_depth,
+			OutputBackend backend) :
+		CRT(common_output_divisor, buffer_depth, backend) {
 	set_new_timing(cycles_per_line, height_of_display, colour_space, colour_cycle_numerator, colour_cycle_denominator, vertical_sync_half_lines, should_alternate);
 }
 
-CRT::CRT(unsigned int cycles_per_line, unsigned int common_output_divisor, DisplayType displayType, unsigned int buffer_depth) :
-		CRT(common_output_divisor, buffer_depth) {
+CRT::CRT(unsigned int cycles_per_line, unsigned int common_output_divisor, DisplayType displayType, unsigned int buffer_depth, OutputBackend backend) :
+		CRT(common_output_divisor, buffer_depth, backend) {
 	set_new_display_type(cycles_per_line, displayType);
 }
 
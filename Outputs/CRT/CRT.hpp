@@ -29,7 +29,7 @@ class Delegate {
 
 class CRT {
 	private:
-		CRT(unsigned int common_output_divisor, unsigned int buffer_depth);
+		CRT(unsigned int common_output_divisor, unsigned int buffer_depth, OutputBackend backend);
 
 		// the incoming clock lengths will be multiplied by something to give at least 1000
 		// sample points per line
@@ -130,6 +130,10 @@ class CRT {
 			work to be offloaded onto the GPU and allowing the output signal to be sampled at a rate appropriate
 			to the display size.
 
+			@param backend The means by which output will be rendered. If this is @c OutputBackend::Software then
+			no OpenGL context is required, either now or later, and @c draw_frame will rasterise into a buffer
+			obtainable via @c get_software_frame.
+
 			@see @c set_rgb_sampling_function , @c set_composite_sampling_function
 		*/
 		CRT(unsigned int cycles_per_line,
@@ -139,7 +143,8 @@ class CRT {
 			unsigned int colour_cycle_numerator, unsigned int colour_cycle_denominator,
 			unsigned int vertical_sync_half_lines,
 			bool should_alternate,
-			unsigned int buffer_depth);
+			unsigned int buffer_depth,
+			OutputBackend backend = OutputBackend::OpenGL);
 
 		/*!	Constructs the CRT with the specified clock rate, with the display height and colour
 			subcarrier frequency dictated by a standard display type and with the requested number of
@@ -151,7 +156,8 @@ class CRT {
 		CRT(unsigned int cycles_per_line,
 			unsigned int common_output_divisor,
 			DisplayType displayType,
-			unsigned int buffer_depth);
+			unsigned int buffer_depth,
+			OutputBackend backend = OutputBackend::OpenGL);
 
 		/*!	Resets the CRT with new timing information. The CRT then continues as though the new timing had
 			been provided at construction. */
@@ -239,6 +245,9 @@ class CRT {
 
 		/*!	Causes appropriate OpenGL or OpenGL ES calls to be issued in order to draw the current CRT state.
 			The caller is responsible for ensuring that a valid OpenGL context exists for the duration of this call.
+
+			If this CRT uses the software backend then no OpenGL calls are made; output is instead rasterised into
+			a frame of @c output_width by @c output_height pixels, available via @c get_software_frame.
 		*/
 		inline void draw_frame(unsigned int output_width, unsigned int output_height, bool only_if_dirty) {
 			{
@@ -362,6 +371,28 @@ class CRT {
 			});
 		}
 
+		/*!	Sets a function that will map from whatever data the machine provided to an RGB colour, for use
+			by the software backend. This should be the CPU equivalent of whichever GLSL sampling function
+			has been supplied. It is ignored by the OpenGL backend.
+
+			If no function is supplied, the software backend will treat the first byte of each sample as a brightness.
+		*/
+		inline void set_software_sampling_function(SoftwareSamplingFunction function) {
+			openGL_output_builder_.set_software_sampling_function(function);
+		}
+
+		/// @returns The backend that was selected at construction.
+		inline OutputBackend get_output_backend() const {
+			return openGL_output_builder_.get_backend();
+		}
+
+		/*!	@returns The frame most recently rasterised by @c draw_frame if this CRT uses the software backend;
+			@c nullptr otherwise. The frame will be modified by the next call to @c draw_frame.
+		*/
+		inline const SoftwareFrame *get_software_frame() const {
+			return openGL_output_builder_.get_software_frame();
+		}
+
 		inline void set_bookender(std::unique_ptr<TextureBuilder::Bookender> bookender) {
 			openGL_output_builder_.texture_builder.set_bookender(std::move(bookender));
 		}
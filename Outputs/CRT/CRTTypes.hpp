@@ -42,6 +42,13 @@ enum class VideoSignal {
 	Composite
 };
 
+enum class OutputBackend {
+	/// Output is composed on the GPU; an OpenGL context must be available for construction and drawing.
+	OpenGL,
+	/// Output is rasterised on the CPU into an in-memory RGB frame; no OpenGL context is required.
+	Software
+};
+
 }
 }
 
@@ -28,14 +28,31 @@ namespace {
 	static const GLenum work_texture_unit				= GL_TEXTURE2;
 }
 
-OpenGLOutputBuilder::OpenGLOutputBuilder(std::size_t bytes_per_pixel) :
+OpenGLOutputBuilder::OpenGLOutputBuilder(std::size_t bytes_per_pixel, OutputBackend backend) :
 		visible_area_(Rect(0, 0, 1, 1)),
 		composite_src_output_y_(0),
 		last_output_width_(0),
 		last_output_height_(0),
 		fence_(nullptr),
-		texture_builder(bytes_per_pixel, source_data_texture_unit),
-		array_builder(SourceVertexBufferDataSize, OutputVertexBufferDataSize) {
+		backend_(backend),
+		texture_builder(bytes_per_pixel, source_data_texture_unit, backend),
+		array_builder(SourceVertexBufferDataSize, OutputVertexBufferDataSize,
+			(backend == OutputBackend::Software) ?
+				std::function<void(bool, uint8_t *, std::size_t)>([this] (bool is_input, uint8_t *data, std::size_t size) {
+					// The software renderer reads data in place, so just note where it is.
+					if(is_input) {
+						submitted_input_ = data;
+						submitted_input_size_ = size;
+					} else {
+						submitted_output_ = data;
+						submitted_output_size_ = size;
+					}
+				}) : nullptr) {
+	if(backend_ == OutputBackend::Software) {
+		software_renderer_.reset(new SoftwareRenderer);
+		return;
+	}
+
 	glBlendFunc(GL_SRC_ALPHA, GL_CONSTANT_COLOR);
 	glBlendColor(0.6f, 0.6f, 0.6f, 1.0f);
 
@@ -68,7 +85,7 @@ OpenGLOutputBuilder::OpenGLOutputBuilder(std::size_t bytes_per_pixel) :
 }
 
 OpenGLOutputBuilder::~OpenGLOutputBuilder() {
-	glDeleteVertexArrays(1, &output_vertex_array_);
+	if(backend_ == OutputBackend::OpenGL) glDeleteVertexArrays(1, &output_vertex_array_);
 }
 
 void OpenGLOutputBuilder::set_target_framebuffer(GLint target_framebuffer) {
@@ -76,6 +93,11 @@ void OpenGLOutputBuilder::set_target_framebuffer(GLint target_framebuffer) {
 }
 
 void OpenGLOutputBuilder::draw_frame(unsigned int output_width, unsigned int output_height, bool only_if_dirty) {
+	if(software_renderer_) {
+		draw_software_frame(output_width, output_height);
+		return;
+	}
+
 	// lock down any other draw_frames
 	draw_mutex_.lock();
 
@@ -251,6 +273,23 @@ void OpenGLOutputBuilder::draw_frame(unsigned int output_width, unsigned int out
 	draw_mutex_.unlock();
 }
 
+void OpenGLOutputBuilder::draw_software_frame(unsigned int output_width, unsigned int output_height) {
+	std::lock_guard<std::mutex> draw_guard(draw_mutex_);
+
+	// Source data is read in place, so the machine is locked out for the duration.
+	std::lock_guard<std::mutex> output_guard(output_mutex_);
+	submitted_input_size_ = submitted_output_size_ = 0;
+	array_builder.submit();
+	texture_builder.submit();
+	composite_src_output_y_ = 0;
+
+	software_renderer_->draw(texture_builder, submitted_input_, submitted_input_size_, submitted_output_, submitted_output_size_, output_width, output_height);
+}
+
+const SoftwareFrame *OpenGLOutputBuilder::get_software_frame() const {
+	return software_renderer_ ? &software_renderer_->get_frame() : nullptr;
+}
+
 void OpenGLOutputBuilder::reset_all_OpenGL_state() {
 	composite_input_shader_program_ = nullptr;
 	composite_separation_filter_program_ = nullptr;
@@ -287,6 +326,11 @@ void OpenGLOutputBuilder::set_rgb_sampling_function(const std::string &shader) {
 	reset_all_OpenGL_state();
 }
 
+void OpenGLOutputBuilder::set_software_sampling_function(SoftwareSamplingFunction function) {
+	std::lock_guard<std::mutex> lock_guard(output_mutex_);
+	if(software_renderer_) software_renderer_->set_sampling_function(function);
+}
+
 // MARK: - Program compilation
 
 void OpenGLOutputBuilder::prepare_composite_input_shaders() {
@@ -424,6 +468,7 @@ void OpenGLOutputBuilder::set_timing(unsigned int input_frequency, unsigned int
 	vertical_period_divider_ = vertical_period_divider;
 
 	set_timing_uniforms();
+	if(software_renderer_) software_renderer_->set_timing(cycles_per_line, height_of_display, horizontal_scan_period, vertical_scan_period, vertical_period_divider);
 }
 
 // MARK: - Internal Configuration
@@ -459,6 +504,7 @@ void OpenGLOutputBuilder::set_colour_space_uniforms() {
 
 void OpenGLOutputBuilder::set_gamma() {
 	if(output_shader_program_) output_shader_program_->set_gamma_ratio(gamma_);
+	if(software_renderer_) software_renderer_->set_gamma(gamma_);
 }
 
 /*!
@@ -519,6 +565,7 @@ void OpenGLOutputBuilder::set_timing_uniforms() {
 
 void OpenGLOutputBuilder::set_integer_coordinate_multiplier(float multiplier) {
 	integer_coordinate_multiplier_ = multiplier;
+	if(software_renderer_) software_renderer_->set_integer_coordinate_multiplier(multiplier);
 	if(composite_input_shader_program_) composite_input_shader_program_->set_integer_coordinate_multiplier(multiplier);
 	if(svideo_input_shader_program_) svideo_input_shader_program_->set_integer_coordinate_multiplier(multiplier);
 	if(rgb_input_shader_program_) rgb_input_shader_program_->set_integer_coordinate_multiplier(multiplier);
@@ -16,6 +16,7 @@
 #include "Shaders/Shader.hpp"
 
 #include "ArrayBuilder.hpp"
+#include "SoftwareRenderer.hpp"
 #include "TextureBuilder.hpp"
 
 #include "Shaders/OutputShader.hpp"
@@ -106,12 +107,19 @@ class OpenGLOutputBuilder {
 
 		float integer_coordinate_multiplier_ = 1.0f;
 
+		// Software output, if selected.
+		const OutputBackend backend_;
+		std::unique_ptr<SoftwareRenderer> software_renderer_;
+		uint8_t *submitted_input_ = nullptr, *submitted_output_ = nullptr;
+		std::size_t submitted_input_size_ = 0, submitted_output_size_ = 0;
+		void draw_software_frame(unsigned int output_width, unsigned int output_height);
+
 	public:
 		// These two are protected by output_mutex_.
 		TextureBuilder texture_builder;
 		ArrayBuilder array_builder;
 
-		OpenGLOutputBuilder(std::size_t bytes_per_pixel);
+		OpenGLOutputBuilder(std::size_t bytes_per_pixel, OutputBackend backend = OutputBackend::OpenGL);
 		~OpenGLOutputBuilder();
 
 		inline void set_colour_format(ColourSpace colour_space, unsigned int colour_cycle_numerator, unsigned int colour_cycle_denominator) {
@@ -124,6 +132,7 @@ class OpenGLOutputBuilder {
 
 		inline void set_visible_area(Rect visible_area) {
 			visible_area_ = visible_area;
+			if(software_renderer_) software_renderer_->set_visible_area(visible_area);
 		}
 
 		inline void set_gamma(float gamma) {
@@ -131,6 +140,10 @@ class OpenGLOutputBuilder {
 			set_gamma();
 		}
 
+		inline OutputBackend get_backend() const {
+			return backend_;
+		}
+
 		inline std::unique_lock<std::mutex> get_output_lock() {
 			return std::unique_lock<std::mutex>(output_mutex_);
 		}
@@ -158,6 +171,8 @@ class OpenGLOutputBuilder {
 		void set_composite_sampling_function(const std::string &);
 		void set_svideo_sampling_function(const std::string &);
 		void set_rgb_sampling_function(const std::string &);
+		void set_software_sampling_function(SoftwareSamplingFunction);
+		const SoftwareFrame *get_software_frame() const;
 		void set_video_signal(VideoSignal);
 		void set_timing(unsigned int input_frequency, unsigned int cycles_per_line, unsigned int height_of_display, unsigned int horizontal_scan_period, unsigned int vertical_scan_period, unsigned int vertical_period_divider);
 		void set_integer_coordinate_multiplier(float multiplier);
@@ -0,0 +1,170 @@
+//
+//  SoftwareRenderer.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "SoftwareRenderer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Outputs::CRT;
+
+namespace {
+
+uint32_t brightness_sample(const uint8_t *sample, unsigned int) {
+	return static_cast<uint32_t>(sample[0]) * 0x010101;
+}
+
+inline uint16_t read_uint16(const uint8_t *location) {
+	return *reinterpret_cast<const uint16_t *>(location);
+}
+
+}
+
+uint32_t Outputs::CRT::software_colour_for_chrominance(float luminance, float phase, float amplitude) {
+	// Treat the colour burst as lying along -U, per PAL and NTSC, and map into YUV.
+	const float u = -0.5f * amplitude * cosf(phase);
+	const float v = 0.5f * amplitude * sinf(phase);
+
+	const float rgb[] = {
+		luminance + 1.13983f * v,
+		luminance - 0.39465f * u - 0.58060f * v,
+		luminance + 2.03211f * u
+	};
+	uint32_t result = 0;
+	for(int c = 0; c < 3; ++c) {
+		result = (result << 8) | static_cast<uint32_t>(255.0f * std::min(1.0f, std::max(0.0f, rgb[c])));
+	}
+	return result;
+}
+
+SoftwareRenderer::SoftwareRenderer() : visible_area_(0, 0, 1, 1) {
+	set_gamma(1.0f);
+}
+
+void SoftwareRenderer::set_sampling_function(SoftwareSamplingFunction function) {
+	sampling_function_ = function;
+}
+
+void SoftwareRenderer::set_integer_coordinate_multiplier(float multiplier) {
+	integer_coordinate_multiplier_ = multiplier;
+}
+
+void SoftwareRenderer::set_gamma(float gamma) {
+	for(int c = 0; c < 256; ++c) {
+		gamma_table_[c] = static_cast<uint8_t>(255.0f * powf(static_cast<float>(c) / 255.0f, gamma) + 0.5f);
+	}
+}
+
+void SoftwareRenderer::set_visible_area(Rect visible_area) {
+	visible_area_ = visible_area;
+}
+
+void SoftwareRenderer::set_timing(unsigned int cycles_per_line, unsigned int height_of_display, unsigned int horizontal_scan_period, unsigned int vertical_scan_period, unsigned int vertical_period_divider) {
+	horizontal_scan_period_ = static_cast<float>(horizontal_scan_period);
+	vertical_scan_period_ = static_cast<float>(vertical_scan_period) / static_cast<float>(vertical_period_divider);
+
+	// Each scan is as tall as the GPU path would draw it: one line of the nominal display, adjusted for the
+	// fact that the scan period excludes retrace.
+	line_height_ = static_cast<float>(cycles_per_line) / (static_cast<float>(height_of_display) * horizontal_scan_period_);
+}
+
+void SoftwareRenderer::draw(const TextureBuilder &texture_builder, const uint8_t *input, std::size_t input_size, const uint8_t *output, std::size_t output_size, unsigned int output_width, unsigned int output_height) {
+	if(frame_.width != output_width || frame_.height != output_height) {
+		frame_.width = output_width;
+		frame_.height = output_height;
+		frame_.pixels.assign(output_width * output_height * 3, 0);
+	}
+	if(!output_width || !output_height) return;
+
+	// Apply the same aspect ratio correction as the OpenGL output shader.
+	Rect area = visible_area_;
+	const float aspect_ratio_multiplier = (static_cast<float>(output_width) / static_cast<float>(output_height)) / (4.0f / 3.0f);
+	const float bonus_width = (aspect_ratio_multiplier - 1.0f) * area.size.width;
+	area.origin.x -= bonus_width * 0.5f * area.size.width;
+	area.size.width *= aspect_ratio_multiplier;
+
+	// Bucket source runs by the intermediate line that they were assigned to.
+	for(auto &line: runs_by_line_) line.clear();
+	for(std::size_t position = 0; position + SourceVertexSize <= input_size; position += SourceVertexSize) {
+		const uint16_t line = read_uint16(&input[position + SourceVertexOffsetOfOutputStart + 2]);
+		if(line < IntermediateBufferHeight) runs_by_line_[line].push_back(position);
+	}
+
+	// Each output run nominates a location on screen for one intermediate line; blank its extent and then
+	// paint whatever source runs fall within it.
+	const float frame_width = static_cast<float>(output_width);
+	const float frame_height = static_cast<float>(output_height);
+	for(std::size_t position = 0; position + OutputVertexSize <= output_size; position += OutputVertexSize) {
+		const uint8_t *const run = &output[position];
+		const uint16_t x1 = read_uint16(&run[OutputVertexOffsetOfHorizontal + 0]);
+		const uint16_t x2 = read_uint16(&run[OutputVertexOffsetOfHorizontal + 2]);
+		const uint16_t y = read_uint16(&run[OutputVertexOffsetOfVertical + 0]);
+		const uint16_t line = read_uint16(&run[OutputVertexOffsetOfVertical + 2]);
+
+		const float scan_y = static_cast<float>(y) / vertical_scan_period_;
+		const int top = std::max(0, static_cast<int>(((scan_y - area.origin.y) / area.size.height) * frame_height));
+		const int bottom = std::min(static_cast<int>(output_height), static_cast<int>(std::ceil(((scan_y + line_height_ - area.origin.y) / area.size.height) * frame_height)));
+		if(top >= bottom) continue;
+
+		const int left = std::max(0, static_cast<int>(((static_cast<float>(x1) / horizontal_scan_period_ - area.origin.x) / area.size.width) * frame_width));
+		const int right = std::min(static_cast<int>(output_width), static_cast<int>(((static_cast<float>(x2) / horizontal_scan_period_ - area.origin.x) / area.size.width) * frame_width));
+		if(left >= right) continue;
+
+		for(int row = top; row < bottom; ++row) {
+			std::fill_n(&frame_.pixels[(static_cast<std::size_t>(row) * output_width + static_cast<std::size_t>(left)) * 3], (right - left) * 3, 0);
+		}
+
+		if(line >= IntermediateBufferHeight) continue;
+		for(const auto source_position: runs_by_line_[line]) {
+			paint_run(texture_builder, &input[source_position], top, bottom, area.origin.x, area.size.width);
+		}
+	}
+}
+
+void SoftwareRenderer::paint_run(const TextureBuilder &texture_builder, const uint8_t *run, int top, int bottom, float origin_x, float width) {
+	const float output_start = static_cast<float>(read_uint16(&run[SourceVertexOffsetOfOutputStart + 0]));
+	const float output_end = static_cast<float>(read_uint16(&run[SourceVertexOffsetOfEnds + 2]));
+	if(output_end <= output_start) return;
+
+	const uint16_t input_x = read_uint16(&run[SourceVertexOffsetOfInputStart + 0]);
+	const uint16_t input_y = read_uint16(&run[SourceVertexOffsetOfInputStart + 2]);
+	const uint16_t input_end = read_uint16(&run[SourceVertexOffsetOfEnds + 0]);
+	if(input_end <= input_x) return;
+
+	const float frame_width = static_cast<float>(frame_.width);
+	const int left = std::max(0, static_cast<int>(((output_start / horizontal_scan_period_ - origin_x) / width) * frame_width + 0.5f));
+	const int right = std::min(static_cast<int>(frame_.width), static_cast<int>(((output_end / horizontal_scan_period_ - origin_x) / width) * frame_width + 0.5f));
+	if(left >= right) return;
+
+	// Map pixel centres back to scan positions, and from there into the source run.
+	const float scan_per_pixel = (width * horizontal_scan_period_) / frame_width;
+	const float samples_per_scan = static_cast<float>(input_end - input_x) / (output_end - output_start);
+	const float last_sample = static_cast<float>(input_end) - 0.001f;
+	const SoftwareSamplingFunction sample = sampling_function_ ? sampling_function_ : brightness_sample;
+
+	uint8_t *target = &frame_.pixels[(static_cast<std::size_t>(top) * frame_.width + static_cast<std::size_t>(left)) * 3];
+	for(int column = left; column < right; ++column) {
+		const float scan_x = (origin_x * horizontal_scan_period_) + (static_cast<float>(column) + 0.5f) * scan_per_pixel;
+		const float source_x = std::min(last_sample, std::max(static_cast<float>(input_x), static_cast<float>(input_x) + (scan_x - output_start) * samples_per_scan));
+
+		const uint32_t colour = sample(
+			texture_builder.get_pixel_pointer(static_cast<uint16_t>(source_x), input_y),
+			static_cast<unsigned int>(source_x * integer_coordinate_multiplier_));
+		target[0] = gamma_table_[(colour >> 16) & 0xff];
+		target[1] = gamma_table_[(colour >> 8) & 0xff];
+		target[2] = gamma_table_[colour & 0xff];
+		target += 3;
+	}
+
+	// Duplicate the painted span down through the rest of this scan's height.
+	const std::size_t row_length = static_cast<std::size_t>(right - left) * 3;
+	const uint8_t *const first_row = &frame_.pixels[(static_cast<std::size_t>(top) * frame_.width + static_cast<std::size_t>(left)) * 3];
+	for(int row = top + 1; row < bottom; ++row) {
+		std::copy(first_row, first_row + row_length, &frame_.pixels[(static_cast<std::size_t>(row) * frame_.width + static_cast<std::size_t>(left)) * 3]);
+	}
+}
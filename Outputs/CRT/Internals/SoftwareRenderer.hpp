@@ -0,0 +1,109 @@
+//
+//  SoftwareRenderer.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef Outputs_CRT_Internals_SoftwareRenderer_hpp
+#define Outputs_CRT_Internals_SoftwareRenderer_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../CRTTypes.hpp"
+#include "CRTConstants.hpp"
+#include "TextureBuilder.hpp"
+
+namespace Outputs {
+namespace CRT {
+
+/*!
+	A software equivalent of the GLSL sampling functions: maps from whatever data the machine
+	provided to an RGB colour.
+
+	@param sample A pointer to the source sample in which this pixel falls.
+	@param icoordinate The horizontal source location as a pixel count, i.e. the sample's
+		horizontal position multiplied by the integer coordinate multiplier, for easier unpacking of
+		multiple-pixels-per-byte formats.
+	@returns The colour as 0x00RRGGBB.
+*/
+typedef uint32_t (* SoftwareSamplingFunction)(const uint8_t *sample, unsigned int icoordinate);
+
+/*!
+	A helper for software sampling functions of machines that natively describe colour as luminance plus
+	a chrominance phase and amplitude.
+
+	@param luminance The luminance, in the range [0, 1].
+	@param phase The chrominance phase relative to the colour burst, in radians.
+	@param amplitude The chrominance amplitude, in the range [0, 1].
+	@returns The colour as 0x00RRGGBB.
+*/
+uint32_t software_colour_for_chrominance(float luminance, float phase, float amplitude);
+
+/*!
+	A frame produced by the software renderer: 24-bit RGB, top line first, with no padding
+	between lines.
+*/
+struct SoftwareFrame {
+	unsigned int width = 0, height = 0;
+	std::vector<uint8_t> pixels;
+};
+
+/*!
+	Rasterises the source and output runs that the CRT would otherwise hand to the GPU directly into
+	a @c SoftwareFrame.
+
+	No attempt is made to model composite or s-video decoding, or the lowpass filtering applied to
+	RGB output; each pixel is an ideal sampling of the machine's output via its @c SoftwareSamplingFunction.
+*/
+class SoftwareRenderer {
+	public:
+		SoftwareRenderer();
+
+		/// Sets the function used to map source data to RGB. If none is set, the first byte of each
+		/// sample is treated as a brightness.
+		void set_sampling_function(SoftwareSamplingFunction function);
+		void set_integer_coordinate_multiplier(float multiplier);
+		void set_gamma(float gamma);
+		void set_visible_area(Rect visible_area);
+		void set_timing(unsigned int cycles_per_line, unsigned int height_of_display, unsigned int horizontal_scan_period, unsigned int vertical_scan_period, unsigned int vertical_period_divider);
+
+		/*!
+			Paints all runs in the supplied source (@c input) and output vertex arrays into the current frame,
+			resizing it first if @c output_width or @c output_height differ from its current dimensions.
+
+			@c texture_builder is used to locate source data, so the caller must ensure that it is not
+			modified for the duration of this call.
+		*/
+		void draw(const TextureBuilder &texture_builder, const uint8_t *input, std::size_t input_size, const uint8_t *output, std::size_t output_size, unsigned int output_width, unsigned int output_height);
+
+		/// @returns The frame as of the most recent call to @c draw.
+		const SoftwareFrame &get_frame() const {
+			return frame_;
+		}
+
+	private:
+		SoftwareSamplingFunction sampling_function_ = nullptr;
+		float integer_coordinate_multiplier_ = 1.0f;
+		Rect visible_area_;
+
+		float horizontal_scan_period_ = 1.0f;
+		float vertical_scan_period_ = 1.0f;
+		float line_height_ = 1.0f;
+
+		uint8_t gamma_table_[256];
+		SoftwareFrame frame_;
+
+		// Source runs, bucketed by the intermediate line they were assigned to.
+		std::vector<std::size_t> runs_by_line_[IntermediateBufferHeight];
+
+		void paint_run(const TextureBuilder &texture_builder, const uint8_t *run, int top, int bottom, float origin_x, float width);
+};
+
+}
+}
+
+#endif /* Outputs_CRT_Internals_SoftwareRenderer_hpp */
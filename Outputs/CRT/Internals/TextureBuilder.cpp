@@ -51,22 +51,24 @@ struct DefaultBookender: public TextureBuilder::Bookender {
 
 }
 
-TextureBuilder::TextureBuilder(std::size_t bytes_per_pixel, GLenum texture_unit) :
-		bytes_per_pixel_(bytes_per_pixel), texture_unit_(texture_unit) {
+TextureBuilder::TextureBuilder(std::size_t bytes_per_pixel, GLenum texture_unit, OutputBackend backend) :
+		bytes_per_pixel_(bytes_per_pixel), texture_unit_(texture_unit), backend_(backend) {
 	image_.resize(bytes_per_pixel * InputBufferBuilderWidth * InputBufferBuilderHeight);
+	set_bookender(nullptr);
+	if(backend_ != OutputBackend::OpenGL) return;
+
 	glGenTextures(1, &texture_name_);
 
 	bind();
 	glTexImage2D(GL_TEXTURE_2D, 0, internalFormatForDepth(bytes_per_pixel), InputBufferBuilderWidth, InputBufferBuilderHeight, 0, formatForDepth(bytes_per_pixel), GL_UNSIGNED_BYTE, nullptr);
-
-	set_bookender(nullptr);
 }
 
 TextureBuilder::~TextureBuilder() {
-	glDeleteTextures(1, &texture_name_);
+	if(backend_ == OutputBackend::OpenGL) glDeleteTextures(1, &texture_name_);
 }
 
 void TextureBuilder::bind() {
+	if(backend_ != OutputBackend::OpenGL) return;
 	glActiveTexture(texture_unit_);
 	glBindTexture(GL_TEXTURE_2D, texture_name_);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -161,7 +163,9 @@ bool TextureBuilder::is_full() {
 }
 
 void TextureBuilder::submit() {
-	if(write_areas_start_y_ < first_unsubmitted_y_) {
+	if(backend_ != OutputBackend::OpenGL) {
+		// There's nowhere to upload to; the caller will read directly from image_.
+	} else if(write_areas_start_y_ < first_unsubmitted_y_) {
 		// A write area start y less than the first line on which submissions began implies it must have wrapped
 		// around. So the submission set is everything back to zero before the current write area plus everything
 		// from the first unsubmitted y downward.
@@ -16,6 +16,7 @@
 
 #include "OpenGL.hpp"
 #include "CRTConstants.hpp"
+#include "../CRTTypes.hpp"
 
 namespace Outputs {
 namespace CRT {
@@ -63,7 +64,10 @@ class TextureBuilder {
 	public:
 		/// Constructs an instance of InputTextureBuilder that contains a texture of colour depth @c bytes_per_pixel;
 		/// this creates a new texture and binds it to the current active texture unit.
-		TextureBuilder(std::size_t bytes_per_pixel, GLenum texture_unit);
+		///
+		/// If @c backend is @c OutputBackend::Software then no texture is created and @c bind and @c submit
+		/// make no OpenGL calls; submitted data remains readable via @c get_pixel_pointer until it is next overwritten.
+		TextureBuilder(std::size_t bytes_per_pixel, GLenum texture_unit, OutputBackend backend = OutputBackend::OpenGL);
 		virtual ~TextureBuilder();
 
 		/// Finds the first available space of at least @c required_length pixels in size which is suitably aligned
@@ -117,10 +121,16 @@ class TextureBuilder {
 		/// Binds this texture to the unit supplied at instantiation.
 		void bind();
 
+		/// @returns A pointer to the sample at (@c x, @c y) in the CPU-side copy of the texture.
+		inline const uint8_t *get_pixel_pointer(uint16_t x, uint16_t y) const {
+			return &image_[((y * InputBufferBuilderWidth) + x) * bytes_per_pixel_];
+		}
+
 	private:
 		// the buffer size and target unit
 		std::size_t bytes_per_pixel_;
 		GLenum texture_unit_;
+		OutputBackend backend_;
 
 		// the buffer
 		std::vector<uint8_t> image_;
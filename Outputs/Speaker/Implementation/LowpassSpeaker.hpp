@@ -142,58 +142,55 @@ template <typename T> class LowpassSpeaker: public Speaker {
 				return;
 			}
 
-			// if the output rate is less than the input rate, or an additional cut-off has been specified, use the filter.
-			if(	filter_parameters.input_cycles_per_second > filter_parameters.output_cycles_per_second ||
-				(filter_parameters.input_cycles_per_second == filter_parameters.output_cycles_per_second && filter_parameters.high_frequency_cutoff >= 0.0)) {
-				while(cycles_remaining) {
-					std::size_t cycles_to_read = std::min(cycles_remaining, input_buffer_.size() - input_buffer_depth_);
-					sample_source_.get_samples(cycles_to_read, &input_buffer_[input_buffer_depth_]);
-					cycles_remaining -= cycles_to_read;
-					input_buffer_depth_ += cycles_to_read;
-
-					if(input_buffer_depth_ == input_buffer_.size()) {
-						output_buffer_[output_buffer_pointer_] = filter_->apply(input_buffer_.data());
-						output_buffer_pointer_++;
-
-						// Announce to delegate if full.
-						if(output_buffer_pointer_ == output_buffer_.size()) {
-							output_buffer_pointer_ = 0;
-							delegate_->speaker_did_complete_samples(this, output_buffer_);
-						}
-
-						// If the next loop around is going to reuse some of the samples just collected, use a memmove to
-						// preserve them in the correct locations (TODO: use a longer buffer to fix that) and don't skip
-						// anything. Otherwise skip as required to get to the next sample batch and don't expect to reuse.
-						uint64_t steps = stepper_->step();
-						if(steps < input_buffer_.size()) {
-							int16_t *input_buffer = input_buffer_.data();
-							std::memmove(	input_buffer,
-											&input_buffer[steps],
-											sizeof(int16_t) * (input_buffer_.size() - steps));
-							input_buffer_depth_ -= steps;
-						} else {
-							if(steps > input_buffer_.size())
-								sample_source_.skip_samples(steps - input_buffer_.size());
-							input_buffer_depth_ = 0;
-						}
-					}
+			// Otherwise resample. Each output sample is the result of a filter window; output samples are not
+			// necessarily aligned with input samples if the output rate is greater than the input rate.
+			if(filter_parameters.input_cycles_per_second <= 0.0f) return;
+			while(true) {
+				output_complete_windows();
+				if(!cycles_remaining) break;
+
+				// If the next window begins beyond everything received, skip straight to it.
+				const uint64_t next_window = window_for_position(next_position_);
+				if(next_window > input_samples_) {
+					const std::size_t cycles_to_skip = static_cast<std::size_t>(std::min(static_cast<uint64_t>(cycles_remaining), next_window - input_samples_));
+					sample_source_.skip_samples(cycles_to_skip);
+					input_samples_ += cycles_to_skip;
+					cycles_remaining -= cycles_to_skip;
+					continue;
 				}
 
-				return;
+				// Otherwise fetch as much input as will fit in the ring buffer alongside the next window.
+				const std::size_t space = input_buffer_mask_ + 1 - static_cast<std::size_t>(input_samples_ - next_window);
+				const std::size_t cycles_to_read = std::min(cycles_remaining, space);
+				receive_input(cycles_to_read);
+				cycles_remaining -= cycles_to_read;
 			}
-
-			// TODO: input rate is less than output rate
 		}
 
 		T &sample_source_;
 
 		std::size_t output_buffer_pointer_ = 0;
-		std::size_t input_buffer_depth_ = 0;
-		std::vector<int16_t> input_buffer_;
 		std::vector<int16_t> output_buffer_;
 
+		// Input is kept in a ring buffer of input_buffer_mask_ + 1 samples, which is followed by a copy of
+		// the ring's first window_length_ - 1 samples so that every filter window can be read contiguously.
+		std::vector<int16_t> input_buffer_;
+		std::size_t input_buffer_mask_ = 0;
+		std::size_t window_length_ = 0;
+
+		// input_samples_ is the total number of input samples received; next_position_ is the position of
+		// the next output window, in units of 1 / filters_.size() input samples.
+		uint64_t input_samples_ = 0;
+		uint64_t next_position_ = 0;
+
+		// Filters are the polyphase components of the low-pass filter; if there is only one then
+		// each output is aligned with an input sample.
+		std::vector<SignalProcessing::FIRFilter> filters_;
 		std::unique_ptr<SignalProcessing::Stepper> stepper_;
-		std::unique_ptr<SignalProcessing::FIRFilter> filter_;
+
+		// Storage for the ring offsets and filter phases of a batch of windows.
+		std::vector<std::size_t> window_offsets_;
+		std::vector<std::size_t> window_phases_;
 
 		std::mutex filter_parameters_mutex_;
 		struct FilterParameters {
@@ -205,8 +202,72 @@ template <typename T> class LowpassSpeaker: public Speaker {
 			bool input_rate_changed = false;
 		} filter_parameters_;
 
+		/// @returns The index of the first input sample of the window for output @c position.
+		uint64_t window_for_position(uint64_t position) const {
+			return (position + filters_.size() - 1) / filters_.size();
+		}
+
+		/// Obtains @c count samples from the sample source and adds them to the ring buffer.
+		void receive_input(std::size_t count) {
+			const std::size_t ring_size = input_buffer_mask_ + 1;
+			while(count) {
+				const std::size_t position = static_cast<std::size_t>(input_samples_) & input_buffer_mask_;
+				const std::size_t length = std::min(count, ring_size - position);
+				sample_source_.get_samples(length, &input_buffer_[position]);
+
+				// Mirror anything at the start of the ring beyond its end.
+				if(position < window_length_ - 1) {
+					std::memcpy(
+						&input_buffer_[ring_size + position],
+						&input_buffer_[position],
+						sizeof(int16_t) * std::min(length, window_length_ - 1 - position));
+				}
+
+				input_samples_ += length;
+				count -= length;
+			}
+		}
+
+		/// Filters every window for which all input has been received, announcing output as it is completed.
+		void output_complete_windows() {
+			const std::size_t number_of_phases = filters_.size();
+			std::size_t windows = 0;
+			while(true) {
+				const uint64_t window = window_for_position(next_position_);
+				const bool window_is_complete = window + window_length_ <= input_samples_;
+				if(window_is_complete) {
+					window_offsets_[windows] = static_cast<std::size_t>(window) & input_buffer_mask_;
+					window_phases_[windows] = static_cast<std::size_t>(window * number_of_phases - next_position_);
+					++windows;
+					next_position_ += stepper_->step();
+				}
+
+				// Filter the batch if there's nothing more to add to it.
+				if(windows && (!window_is_complete || output_buffer_pointer_ + windows == output_buffer_.size())) {
+					int16_t *const destination = &output_buffer_[output_buffer_pointer_];
+					if(number_of_phases == 1) {
+						filters_[0].apply(input_buffer_.data(), window_offsets_.data(), windows, destination);
+					} else {
+						for(std::size_t c = 0; c < windows; ++c) {
+							destination[c] = filters_[window_phases_[c]].apply(&input_buffer_[window_offsets_[c]]);
+						}
+					}
+					output_buffer_pointer_ += windows;
+					windows = 0;
+
+					// Announce to delegate if full.
+					if(output_buffer_pointer_ == output_buffer_.size()) {
+						output_buffer_pointer_ = 0;
+						delegate_->speaker_did_complete_samples(this, output_buffer_);
+					}
+				}
+
+				if(!window_is_complete) return;
+			}
+		}
+
 		void update_filter_coefficients(const FilterParameters &filter_parameters) {
-			float high_pass_frequency = filter_parameters.output_cycles_per_second / 2.0f;
+			float high_pass_frequency = std::min(filter_parameters.output_cycles_per_second, filter_parameters.input_cycles_per_second) / 2.0f;
 			if(filter_parameters.high_frequency_cutoff > 0.0) {
 				high_pass_frequency = std::min(filter_parameters.high_frequency_cutoff, high_pass_frequency);
 			}
@@ -217,21 +278,47 @@ template <typename T> class LowpassSpeaker: public Speaker {
 			);
 			number_of_taps = (number_of_taps * 2) | 1;
 
+			// Decimate directly from the input if it is at least as fast as the output; otherwise
+			// interpolate between input samples with a polyphase filter.
 			output_buffer_pointer_ = 0;
+			if(filter_parameters.input_cycles_per_second >= filter_parameters.output_cycles_per_second) {
+				filters_.clear();
+				filters_.push_back(SignalProcessing::FIRFilter(
+					number_of_taps,
+					filter_parameters.input_cycles_per_second,
+					0.0f,
+					high_pass_frequency,
+					SignalProcessing::FIRFilter::DefaultAttenuation));
+			} else {
+				filters_ = SignalProcessing::FIRFilter::polyphase_filters(
+					InterpolationPhases,
+					number_of_taps,
+					filter_parameters.input_cycles_per_second,
+					0.0f,
+					high_pass_frequency,
+					SignalProcessing::FIRFilter::DefaultAttenuation);
+			}
 			stepper_.reset(new SignalProcessing::Stepper(
-				static_cast<uint64_t>(filter_parameters.input_cycles_per_second),
+				static_cast<uint64_t>(filter_parameters.input_cycles_per_second) * filters_.size(),
 				static_cast<uint64_t>(filter_parameters.output_cycles_per_second)));
 
-			filter_.reset(new SignalProcessing::FIRFilter(
-				static_cast<unsigned int>(number_of_taps),
-				filter_parameters.input_cycles_per_second,
-				0.0,
-				high_pass_frequency,
-				SignalProcessing::FIRFilter::DefaultAttenuation));
-
-			input_buffer_.resize(static_cast<std::size_t>(number_of_taps));
-			input_buffer_depth_ = 0;
+			// Size the ring to hold enough input to complete an entire output buffer in one batch.
+			window_length_ = filters_[0].get_number_of_taps();
+			const std::size_t input_per_output = (filter_parameters.output_cycles_per_second > 0.0f) ?
+				static_cast<std::size_t>(ceilf(filter_parameters.input_cycles_per_second / filter_parameters.output_cycles_per_second)) : 1;
+			std::size_t ring_size = 1;
+			while(ring_size < window_length_ + input_per_output * output_buffer_.size()) ring_size <<= 1;
+
+			input_buffer_mask_ = ring_size - 1;
+			input_buffer_.resize(ring_size + window_length_ - 1);
+			input_samples_ = next_position_ = 0;
+			window_offsets_.resize(output_buffer_.size());
+			window_phases_.resize(output_buffer_.size());
 		}
+
+		/// The number of phases used when interpolating, which is the resolution at which output samples
+		/// are positioned between input samples.
+		static constexpr std::size_t InterpolationPhases = 32;
 };
 
 }
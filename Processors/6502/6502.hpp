@@ -15,6 +15,7 @@
 
 #include "../RegisterSizes.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace CPU {
 namespace MOS6502 {
@@ -178,6 +179,11 @@ class ProcessorBase: public ProcessorStorage {
 			@returns @c true if the 6502 is jammed; @c false otherwise.
 		*/
 		bool is_jammed();
+
+		/*!
+			Records or restores all processor state, including that of any partially-completed instruction.
+		*/
+		void serialise(State::Archive &archive);
 };
 
 /*!
@@ -42,3 +42,46 @@ void ProcessorBase::set_value_of_register(Register r, uint16_t value) {
 bool ProcessorBase::is_jammed() {
 	return is_jammed_;
 }
+
+void ProcessorBase::serialise(State::Archive &archive) {
+	archive.tag("MOS6502");
+
+	// The scheduled program counter is recorded as the index of the micro-program it points into, plus an offset.
+	struct Program {
+		const MicroOp *start;
+		std::size_t length;
+	} programs[] = {
+		{&operations[0][0], sizeof(operations) / sizeof(MicroOp)},
+		{reset_program, 9},
+		{irq_program, 11},
+		{nmi_program, 10},
+		{branch_program, 3},
+		{fetch_decode_execute_program, 3},
+	};
+	uint8_t program = 0xff;
+	if(archive.is_saving() && scheduled_program_counter_) {
+		for(program = 0; program < sizeof(programs) / sizeof(*programs); ++program) {
+			if(scheduled_program_counter_ >= programs[program].start && scheduled_program_counter_ <= programs[program].start + programs[program].length) break;
+		}
+	}
+	archive(program);
+	if(program == 0xff) {
+		if(!archive.is_saving()) scheduled_program_counter_ = nullptr;
+	} else if(program < sizeof(programs) / sizeof(*programs)) {
+		// The program counter may legitimately sit just beyond the final micro-op, as per the search above.
+		const MicroOp *start = programs[program].start;
+		archive.pointer(scheduled_program_counter_, start, programs[program].length + 1);
+	} else {
+		archive.invalidate();
+	}
+
+	archive(pc_, last_operation_pc_, a_, x_, y_, s_);
+	archive(carry_flag_, negative_result_, zero_result_, decimal_flag_, overflow_flag_, inverse_interrupt_flag_);
+	archive(operation_, operand_, address_, next_address_);
+	archive(next_bus_operation_, bus_address_, throwaway_target_);
+	archive(is_jammed_, cycles_left_to_run_, interrupt_requests_, ready_is_active_, ready_line_is_enabled_);
+	archive(irq_line_, irq_request_history_, nmi_line_is_enabled_, set_overflow_line_is_enabled_);
+
+	// The bus value pointer always refers to a member of this class.
+	archive.pointer(bus_value_, reinterpret_cast<uint8_t *>(static_cast<ProcessorStorage *>(this)), sizeof(ProcessorStorage));
+}
@@ -244,6 +244,57 @@ const ProcessorStorage::MicroOp ProcessorStorage::operations[256][10] = {
 #undef Immediate
 #undef Implied
 
+const ProcessorStorage::MicroOp ProcessorStorage::reset_program[] = {
+	CycleFetchOperand,
+	CycleFetchOperand,
+	CycleNoWritePush,
+	CycleNoWritePush,
+	OperationRSTPickVector,
+	CycleNoWritePush,
+	CycleReadVectorLow,
+	CycleReadVectorHigh,
+	OperationMoveToNextProgram
+};
+
+const ProcessorStorage::MicroOp ProcessorStorage::irq_program[] = {
+	CycleFetchOperand,
+	CycleFetchOperand,
+	CyclePushPCH,
+	CyclePushPCL,
+	OperationBRKPickVector,
+	OperationSetOperandFromFlags,
+	CyclePushOperand,
+	OperationSetI,
+	CycleReadVectorLow,
+	CycleReadVectorHigh,
+	OperationMoveToNextProgram
+};
+
+const ProcessorStorage::MicroOp ProcessorStorage::nmi_program[] = {
+	CycleFetchOperand,
+	CycleFetchOperand,
+	CyclePushPCH,
+	CyclePushPCL,
+	OperationNMIPickVector,
+	OperationSetOperandFromFlags,
+	CyclePushOperand,
+	CycleReadVectorLow,
+	CycleReadVectorHigh,
+	OperationMoveToNextProgram
+};
+
+const ProcessorStorage::MicroOp ProcessorStorage::branch_program[] = {
+	CycleReadFromPC,
+	CycleAddSignedOperandToPC,
+	OperationMoveToNextProgram
+};
+
+const ProcessorStorage::MicroOp ProcessorStorage::fetch_decode_execute_program[] = {
+	CycleFetchOperation,
+	CycleFetchOperand,
+	OperationDecodeOperation
+};
+
 ProcessorStorage::ProcessorStorage() {
 	// only the interrupt flag is defined upon reset but get_flags isn't going to
 	// mask the other flags so we need to do that, at least
@@ -63,6 +63,8 @@ class ProcessorStorage {
 		};
 
 		static const MicroOp operations[256][10];
+		static const MicroOp reset_program[], irq_program[], nmi_program[];
+		static const MicroOp branch_program[], fetch_decode_execute_program[];
 
 		const MicroOp *scheduled_program_counter_ = nullptr;
 
@@ -86,6 +88,7 @@ class ProcessorStorage {
 		BusOperation next_bus_operation_ = BusOperation::None;
 		uint16_t bus_address_;
 		uint8_t *bus_value_;
+		uint8_t throwaway_target_;
 
 		/*!
 			Gets the flags register.
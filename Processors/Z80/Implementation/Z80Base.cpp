@@ -119,3 +119,52 @@ void ProcessorBase::set_value_of_register(Register r, uint16_t value) {
 		default: break;
 	}
 }
+
+void ProcessorBase::serialise(State::Archive &archive) {
+	archive.tag("Z80");
+
+	// The instruction page and scheduled program counter are recorded as indices into the lists of
+	// all pages and all micro-programs.
+	InstructionPage *const pages[] = {&base_page_, &ed_page_, &fd_page_, &dd_page_, &cb_page_, &fdcb_page_, &ddcb_page_};
+	const std::size_t number_of_pages = sizeof(pages) / sizeof(*pages);
+	uint8_t page = 0;
+	while(archive.is_saving() && page < number_of_pages && pages[page] != current_instruction_page_) ++page;
+	archive(page);
+	if(page >= number_of_pages) {
+		archive.invalidate();
+		return;
+	}
+	current_instruction_page_ = pages[page];
+
+	std::vector<const std::vector<MicroOp> *> programs = {
+		&conditional_call_untaken_program_, &reset_program_, &irq_program_[0], &irq_program_[1], &irq_program_[2], &nmi_program_
+	};
+	for(auto instruction_page: pages) {
+		programs.push_back(&instruction_page->all_operations);
+		programs.push_back(&instruction_page->fetch_decode_execute);
+	}
+	uint8_t program = 0xff;
+	if(archive.is_saving() && scheduled_program_counter_) {
+		for(program = 0; program < programs.size(); ++program) {
+			const MicroOp *const start = programs[program]->data();
+			if(scheduled_program_counter_ >= start && scheduled_program_counter_ <= start + programs[program]->size()) break;
+		}
+	}
+	archive(program);
+	if(program == 0xff) {
+		if(!archive.is_saving()) scheduled_program_counter_ = nullptr;
+	} else if(program < programs.size()) {
+		// The program counter may legitimately sit just beyond the final micro-op, as per the search above.
+		archive.pointer(scheduled_program_counter_, programs[program]->data(), programs[program]->size() + 1);
+	} else {
+		archive.invalidate();
+	}
+
+	archive(a_, bc_, de_, hl_, afDash_, bcDash_, deDash_, hlDash_);
+	archive(ix_, iy_, pc_, sp_, ir_, refresh_addr_);
+	archive(iff1_, iff2_, interrupt_mode_, pc_increment_);
+	archive(sign_result_, zero_result_, half_carry_result_, bit53_result_, parity_overflow_result_, subtract_flag_, carry_result_);
+	archive(halt_mask_, flag_adjustment_history_, number_of_cycles_);
+	archive(request_status_, last_request_status_, irq_line_, nmi_line_, bus_request_line_, wait_line_);
+	archive(operation_, temp16_, memptr_, temp8_);
+}
@@ -15,6 +15,7 @@
 
 #include "../RegisterSizes.hpp"
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../State/Archive.hpp"
 
 namespace CPU {
 namespace Z80 {
@@ -223,6 +224,11 @@ class ProcessorBase: public ProcessorStorage {
 			reset at the first opportunity. Use @c reset_power_on to disable that behaviour.
 		*/
 		void reset_power_on();
+
+		/*!
+			Records or restores all processor state, including that of any partially-completed instruction.
+		*/
+		void serialise(State::Archive &archive);
 };
 
 /*!
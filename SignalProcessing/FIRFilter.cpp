@@ -7,8 +7,22 @@
 //
 
 #include "FIRFilter.hpp"
+#include <algorithm>
 #include <cmath>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define FIR_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 using namespace SignalProcessing;
 
 /*
@@ -31,6 +45,104 @@ using namespace SignalProcessing;
 		"DIGITAL SIGNAL PROCESSING, II", IEEE Press, pages 123-126.
 */
 
+namespace {
+
+/*
+	Dot product kernels. All accumulate into 32-bit integers and, since integer addition
+	wraps consistently regardless of order, all produce exactly the same results.
+*/
+
+int dot_product_scalar(const short *coefficients, const short *samples, std::size_t count) {
+	int result = 0;
+	for(std::size_t c = 0; c < count; ++c) {
+		result += coefficients[c] * samples[c];
+	}
+	return result;
+}
+
+#if defined(__SSE2__)
+int dot_product_sse2(const short *coefficients, const short *samples, std::size_t count) {
+	__m128i sums = _mm_setzero_si128();
+	std::size_t c = 0;
+	for(; c + 8 <= count; c += 8) {
+		const __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&coefficients[c]));
+		const __m128i rhs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&samples[c]));
+		sums = _mm_add_epi32(sums, _mm_madd_epi16(lhs, rhs));
+	}
+
+	sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+	sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(sums) + dot_product_scalar(&coefficients[c], &samples[c], count - c);
+}
+#endif
+
+#if defined(FIR_AVX2)
+__attribute__((target("avx2")))
+int dot_product_avx2(const short *coefficients, const short *samples, std::size_t count) {
+	__m256i sums = _mm256_setzero_si256();
+	std::size_t c = 0;
+	for(; c + 16 <= count; c += 16) {
+		const __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&coefficients[c]));
+		const __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&samples[c]));
+		sums = _mm256_add_epi32(sums, _mm256_madd_epi16(lhs, rhs));
+	}
+
+	__m128i half_sums = _mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+	half_sums = _mm_add_epi32(half_sums, _mm_shuffle_epi32(half_sums, _MM_SHUFFLE(1, 0, 3, 2)));
+	half_sums = _mm_add_epi32(half_sums, _mm_shuffle_epi32(half_sums, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(half_sums) + dot_product_scalar(&coefficients[c], &samples[c], count - c);
+}
+#endif
+
+#if defined(__ARM_NEON)
+int dot_product_neon(const short *coefficients, const short *samples, std::size_t count) {
+	int32x4_t sums = vdupq_n_s32(0);
+	std::size_t c = 0;
+	for(; c + 8 <= count; c += 8) {
+		const int16x8_t lhs = vld1q_s16(&coefficients[c]);
+		const int16x8_t rhs = vld1q_s16(&samples[c]);
+		sums = vmlal_s16(sums, vget_low_s16(lhs), vget_low_s16(rhs));
+		sums = vmlal_s16(sums, vget_high_s16(lhs), vget_high_s16(rhs));
+	}
+
+	const int32x2_t pair_sums = vadd_s32(vget_low_s32(sums), vget_high_s32(sums));
+	return vget_lane_s32(vpadd_s32(pair_sums, pair_sums), 0) + dot_product_scalar(&coefficients[c], &samples[c], count - c);
+}
+#endif
+
+}
+
+FIRFilter::DotProduct FIRFilter::best_dot_product() {
+	// Determined once, upon first use.
+	static const DotProduct dot_product = []() -> DotProduct {
+#if defined(FIR_AVX2)
+		if(__builtin_cpu_supports("avx2")) return &dot_product_avx2;
+#endif
+#if defined(__SSE2__)
+		return &dot_product_sse2;
+#elif defined(__ARM_NEON)
+		return &dot_product_neon;
+#else
+		return &dot_product_scalar;
+#endif
+	}();
+	return dot_product;
+}
+
+void FIRFilter::apply(const short *src, const std::size_t *offsets, std::size_t count, short *destination) const {
+#ifdef __APPLE__
+	for(std::size_t c = 0; c < count; ++c) {
+		vDSP_dotpr_s1_15(filter_coefficients_.data(), 1, &src[offsets[c]], 1, &destination[c], filter_coefficients_.size());
+	}
+#else
+	const short *const coefficients = filter_coefficients_.data();
+	const std::size_t number_of_taps = filter_coefficients_.size();
+	for(std::size_t c = 0; c < count; ++c) {
+		destination[c] = static_cast<short>(dot_product_(coefficients, &src[offsets[c]], number_of_taps) >> FixedShift);
+	}
+#endif
+}
+
 /*! Evaluates the 0th order Bessel function at @c a. */
 float FIRFilter::ino(float a) {
 	float d = 0.0f;
@@ -46,7 +158,7 @@ float FIRFilter::ino(float a) {
 	return s;
 }
 
-void FIRFilter::coefficients_for_idealised_filter_response(short *filter_coefficients, float *A, float attenuation, std::size_t number_of_taps) {
+void FIRFilter::coefficients_for_idealised_filter_response(float *filter_coefficients, float *A, float attenuation, std::size_t number_of_taps) {
 	/* calculate alpha, which is the Kaiser-Bessel window shape factor */
 	float a;	// to take the place of alpha in the normal derivation
 
@@ -83,10 +195,9 @@ void FIRFilter::coefficients_for_idealised_filter_response(short *filter_coeffic
 		coefficientTotal += filter_coefficients_float[i];
 	}
 
-	/* we'll also need integer versions, potentially */
 	float coefficientMultiplier = 1.0f / coefficientTotal;
 	for(std::size_t i = 0; i < number_of_taps; ++i) {
-		filter_coefficients[i] = static_cast<short>(filter_coefficients_float[i] * FixedMultiplier * coefficientMultiplier);
+		filter_coefficients[i] = filter_coefficients_float[i] * coefficientMultiplier;
 	}
 }
 
@@ -98,7 +209,7 @@ std::vector<float> FIRFilter::get_coefficients() const {
 	return coefficients;
 }
 
-FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) {
+std::vector<float> FIRFilter::idealised_coefficients(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) {
 	// we must be asked to filter based on an odd number of
 	// taps, and at least three
 	if(number_of_taps < 3) number_of_taps = 3;
@@ -107,9 +218,6 @@ FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float
 	// ensure we have an odd number of taps
 	number_of_taps |= 1;
 
-	// store instance variables
-	filter_coefficients_.resize(number_of_taps);
-
 	/* calculate idealised filter response */
 	std::size_t Np = (number_of_taps - 1) / 2;
 	float two_over_sample_rate = 2.0f / input_sample_rate;
@@ -125,10 +233,44 @@ FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float
 			) / i_pi;
 	}
 
-	FIRFilter::coefficients_for_idealised_filter_response(filter_coefficients_.data(), A.data(), attenuation, number_of_taps);
+	std::vector<float> coefficients(number_of_taps);
+	FIRFilter::coefficients_for_idealised_filter_response(coefficients.data(), A.data(), attenuation, number_of_taps);
+	return coefficients;
+}
+
+FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) :
+	dot_product_(best_dot_product()) {
+	for(const auto coefficient: idealised_coefficients(number_of_taps, input_sample_rate, low_frequency, high_frequency, attenuation)) {
+		filter_coefficients_.push_back(static_cast<short>(coefficient * FixedMultiplier));
+	}
+}
+
+std::vector<FIRFilter> FIRFilter::polyphase_filters(std::size_t number_of_phases, std::size_t taps_per_phase, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) {
+	// Design a single filter at the interpolated rate, then distribute its taps between phases; phase p
+	// takes taps p, p + number_of_phases, p + 2*number_of_phases, etc. Each phase sees only one in every
+	// number_of_phases of the samples that the single filter would, so is scaled up to compensate.
+	const std::vector<float> coefficients = idealised_coefficients(
+		number_of_phases * taps_per_phase - 1,
+		input_sample_rate * static_cast<float>(number_of_phases),
+		low_frequency,
+		high_frequency,
+		attenuation);
+
+	std::vector<FIRFilter> filters;
+	for(std::size_t phase = 0; phase < number_of_phases; ++phase) {
+		std::vector<float> phase_coefficients(taps_per_phase, 0.0f);
+		for(std::size_t c = 0; c < taps_per_phase; ++c) {
+			const std::size_t index = phase + c * number_of_phases;
+			if(index >= coefficients.size()) break;
+			phase_coefficients[c] = std::max(-1.0f, std::min(1.0f, coefficients[index] * static_cast<float>(number_of_phases)));
+		}
+		filters.emplace_back(phase_coefficients);
+	}
+	return filters;
 }
 
-FIRFilter::FIRFilter(const std::vector<float> &coefficients) {
+FIRFilter::FIRFilter(const std::vector<float> &coefficients) :
+	dot_product_(best_dot_product()) {
 	for(const auto coefficient: coefficients) {
 		filter_coefficients_.push_back(static_cast<short>(coefficient * FixedMultiplier));
 	}
@@ -13,6 +13,7 @@
 #include <Accelerate/Accelerate.h>
 #endif
 
+#include <cstddef>
 #include <vector>
 
 namespace SignalProcessing {
@@ -22,6 +23,9 @@ namespace SignalProcessing {
 
 	The number of taps (ie, samples considered simultaneously to make an output sample) is configurable;
 	smaller numbers permit a filter that operates more quickly and with less lag but less effectively.
+
+	Filtering uses vDSP on Apple platforms. Elsewhere it uses the widest of AVX2, SSE2 or NEON that is
+	available, as determined at runtime where necessary, or plain C++ if none is.
 */
 class FIRFilter {
 	private:
@@ -41,6 +45,21 @@ class FIRFilter {
 		FIRFilter(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation);
 		FIRFilter(const std::vector<float> &coefficients);
 
+		/*!
+			Creates the polyphase components of a filter for a signal that is to be upsampled by a factor of
+			@c number_of_phases, i.e. a set of filters that can be applied directly to the original signal to produce
+			the output that applying a single filter to the upsampled signal would. Phase p produces the output for a
+			window that begins p / @c number_of_phases samples before the first input sample supplied to it.
+
+			@param number_of_phases The upsampling factor, and the number of filters to return.
+			@param taps_per_phase The size of window for input data used by each of the filters.
+			@param input_sample_rate The sampling rate of the input signal, before upsampling.
+			@param low_frequency The lowest frequency of signal to retain in the output.
+			@param high_frequency The highest frequency of signal to retain in the output.
+			@param attenuation The attenuation of the discarded frequencies.
+		*/
+		static std::vector<FIRFilter> polyphase_filters(std::size_t number_of_phases, std::size_t taps_per_phase, float input_sample_rate, float low_frequency, float high_frequency, float attenuation);
+
 		/*! A suggested default attenuation value. */
 		constexpr static float DefaultAttenuation = 60.0f;
 
@@ -56,14 +75,16 @@ class FIRFilter {
 				vDSP_dotpr_s1_15(filter_coefficients_.data(), 1, src, 1, &result, filter_coefficients_.size());
 				return result;
 			#else
-				int outputValue = 0;
-				for(std::size_t c = 0; c < filter_coefficients_.size(); ++c) {
-					outputValue += filter_coefficients_[c] * src[c];
-				}
-				return static_cast<short>(outputValue >> FixedShift);
+				return static_cast<short>(dot_product_(filter_coefficients_.data(), src, filter_coefficients_.size()) >> FixedShift);
 			#endif
 		}
 
+		/*!
+			Applies the filter to @c count batches of input samples, the nth of which begins at @c src + @c offsets[n],
+			storing the results to @c destination.
+		*/
+		void apply(const short *src, const std::size_t *offsets, std::size_t count, short *destination) const;
+
 		/*! @returns The number of taps used by this filter. */
 		inline std::size_t get_number_of_taps() const {
 			return filter_coefficients_.size();
@@ -87,7 +108,13 @@ class FIRFilter {
 	private:
 		std::vector<short> filter_coefficients_;
 
-		static void coefficients_for_idealised_filter_response(short *filterCoefficients, float *A, float attenuation, std::size_t numberOfTaps);
+		/// The type of a function that returns the sum of the products of @c count pairs of values from @c coefficients and @c samples.
+		typedef int (*DotProduct)(const short *coefficients, const short *samples, std::size_t count);
+		DotProduct dot_product_;
+		static DotProduct best_dot_product();
+
+		static std::vector<float> idealised_coefficients(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation);
+		static void coefficients_for_idealised_filter_response(float *filterCoefficients, float *A, float attenuation, std::size_t numberOfTaps);
 		static float ino(float a);
 };
 
@@ -0,0 +1,167 @@
+//
+//  Archive.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef State_Archive_hpp
+#define State_Archive_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace State {
+
+/*!
+	An archive is a bidirectional serialiser: it either records state into a buffer or restores
+	state from one. Components describe their state once, by passing each stateful member to an
+	archive in a fixed order, and that single description serves for both directions.
+
+	Restoration stops at the first inconsistency between the data supplied and the order of requests,
+	after which the archive becomes invalid and all further requests leave their targets untouched.
+*/
+class Archive {
+	public:
+		/// Constructs an archive that records state.
+		Archive() : is_saving_(true) {}
+
+		/// Constructs an archive that restores state from @c data.
+		Archive(const std::vector<uint8_t> &data) : is_saving_(false), data_(data) {}
+
+		/// @returns @c true if this archive is recording state; @c false if it is restoring it.
+		bool is_saving() const {
+			return is_saving_;
+		}
+
+		/// @returns @c false if a restoration has failed; @c true otherwise.
+		bool is_valid() const {
+			return is_valid_;
+		}
+
+		/// Marks this archive as invalid; components may use this to reject state they cannot accept.
+		void invalidate() {
+			is_valid_ = false;
+		}
+
+		/// @returns The recorded state.
+		const std::vector<uint8_t> &get_data() const {
+			return data_;
+		}
+
+		/// @returns @c true if this is a restoring archive and all of its data has been consumed.
+		bool is_complete() const {
+			return !is_saving_ && offset_ == data_.size();
+		}
+
+		/// Records or restores @c size bytes at @c data.
+		void bytes(void *data, std::size_t size) {
+			if(!is_valid_) return;
+
+			if(is_saving_) {
+				const uint8_t *const source = static_cast<const uint8_t *>(data);
+				data_.insert(data_.end(), source, source + size);
+			} else {
+				if(data_.size() - offset_ < size) {
+					is_valid_ = false;
+					return;
+				}
+				std::memcpy(data, &data_[offset_], size);
+				offset_ += size;
+			}
+		}
+
+		/// Records or restores each of the supplied values, all of which must be plain data that can safely be copied bytewise.
+		template <typename T, typename... Tail> void operator()(T &value, Tail &... tail) {
+			static_assert(
+				std::is_standard_layout<T>::value && std::is_trivially_destructible<T>::value && !std::is_pointer<T>::value,
+				"Only plain values can be archived directly; use Archive::pointer for pointers");
+			bytes(&value, sizeof(T));
+			(*this)(tail...);
+		}
+		void operator()() {}
+
+		/// Records or restores the contents of @c vector, including its size.
+		template <typename T> void vector(std::vector<T> &vector) {
+			static_assert(std::is_standard_layout<T>::value && std::is_trivially_destructible<T>::value, "Only vectors of plain values can be archived directly");
+			uint32_t size = static_cast<uint32_t>(vector.size());
+			(*this)(size);
+			if(!is_valid_) return;
+
+			if(!is_saving_) {
+				if(static_cast<std::size_t>(size) * sizeof(T) > data_.size() - offset_) {
+					is_valid_ = false;
+					return;
+				}
+				vector.resize(size);
+			}
+			bytes(vector.data(), vector.size() * sizeof(T));
+		}
+
+		/// Records or restores the contents of @c vector, which must be the same size upon restoration as it was when recorded.
+		template <typename T> void contents(std::vector<T> &vector) {
+			uint32_t size = static_cast<uint32_t>(vector.size());
+			(*this)(size);
+			if(!is_valid_) return;
+			if(size != vector.size()) {
+				is_valid_ = false;
+				return;
+			}
+			bytes(vector.data(), vector.size() * sizeof(T));
+		}
+
+		/// Records or restores @c string.
+		void string(std::string &string) {
+			std::vector<char> characters(string.begin(), string.end());
+			vector(characters);
+			if(!is_saving_ && is_valid_) string.assign(characters.begin(), characters.end());
+		}
+
+		/*!
+			Records or restores @c pointer, which must either be @c nullptr or point to one of the
+			@c count elements starting at @c base.
+		*/
+		template <typename T> void pointer(T *&pointer, T *base, std::size_t count) {
+			int32_t index = -1;
+			if(is_saving_ && pointer) {
+				index = static_cast<int32_t>(pointer - base);
+			}
+			(*this)(index);
+			if(is_saving_ || !is_valid_) return;
+
+			if(index < 0) {
+				pointer = nullptr;
+			} else if(static_cast<std::size_t>(index) < count) {
+				pointer = base + index;
+			} else {
+				is_valid_ = false;
+			}
+		}
+
+		/*!
+			Records or verifies a section marker. Markers allow state recorded by one build to be rejected
+			by another that would otherwise misinterpret it, and should be used at the start of each
+			component's state.
+		*/
+		void tag(const char *name) {
+			std::string value = name;
+			std::string recorded = value;
+			string(recorded);
+			if(recorded != value) is_valid_ = false;
+		}
+
+	private:
+		const bool is_saving_;
+		bool is_valid_ = true;
+		std::vector<uint8_t> data_;
+		std::size_t offset_ = 0;
+};
+
+}
+
+#endif /* State_Archive_hpp */
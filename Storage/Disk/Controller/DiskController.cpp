@@ -113,3 +113,8 @@ void Controller::end_writing() {
 bool Controller::is_reading() {
 	return is_reading_;
 }
+
+void Controller::serialise(State::Archive &archive) {
+	archive(bit_length_, is_reading_);
+	pll_->serialise(archive);
+}
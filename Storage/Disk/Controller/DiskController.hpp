@@ -16,6 +16,7 @@
 
 #include "../../../ClockReceiver/ClockReceiver.hpp"
 #include "../../../ClockReceiver/Sleeper.hpp"
+#include "../../../State/Archive.hpp"
 
 namespace Storage {
 namespace Disk {
@@ -101,6 +102,12 @@ class Controller: public DigitalPhaseLockedLoop::Delegate, public Drive::EventDe
 		*/
 		bool is_sleeping();
 
+		/*!
+			Records or restores the PLL and the controller's read/write mode. Drives are not included;
+			they should be serialised by their owner.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
 		Time bit_length_;
 		int clock_rate_multiplier_ = 1;
@@ -167,3 +167,13 @@ void MFMController::write_start_of_track() {
 		write_n_bytes(26, 0xff);
 	}
 }
+
+void MFMController::serialise(State::Archive &archive) {
+	Controller::serialise(archive);
+	shifter_.serialise(archive);
+	archive(latest_token_, is_double_density_, data_mode_, last_bit_);
+
+	uint16_t crc = crc_generator_.get_value();
+	archive(crc);
+	crc_generator_.set_value(crc);
+}
@@ -145,6 +145,9 @@ class MFMController: public Controller {
 		*/
 		void write_start_of_track();
 
+		/// Records or restores the PLL, shift register, CRC and data mode, as well as the state recorded by Controller.
+		void serialise(State::Archive &archive);
+
 	private:
 		// Storage::Disk::Controller
 		virtual void process_input_bit(int value);
@@ -67,3 +67,18 @@ void DigitalPhaseLockedLoop::post_phase_offset(int new_phase, int new_offset) {
 	// use a simple spring mechanism as a lowpass filter for phase
 	phase_ -= (error + 1) >> 1;
 }
+
+void DigitalPhaseLockedLoop::serialise(State::Archive &archive) {
+	archive.tag("DPLL");
+	archive.contents(offset_history_);
+
+	uint32_t offset_history_pointer = static_cast<uint32_t>(offset_history_pointer_);
+	archive(offset_history_pointer);
+	if(offset_history_pointer < offset_history_.size()) {
+		offset_history_pointer_ = offset_history_pointer;
+	} else {
+		archive.invalidate();
+	}
+
+	archive(offset_, phase_, window_length_, window_was_filled_, clocks_per_bit_, tolerance_);
+}
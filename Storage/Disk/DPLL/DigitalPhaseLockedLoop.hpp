@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "../../../ClockReceiver/ClockReceiver.hpp"
+#include "../../../State/Archive.hpp"
 
 namespace Storage {
 
@@ -49,6 +50,9 @@ class DigitalPhaseLockedLoop {
 			delegate_ = delegate;
 		}
 
+		/// Records or restores the loop's window, phase and history.
+		void serialise(State::Archive &archive);
+
 	private:
 		Delegate *delegate_ = nullptr;
 
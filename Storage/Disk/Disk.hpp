@@ -54,6 +54,12 @@ class Disk {
 		*/
 		virtual void flush_tracks() = 0;
 
+		/*!
+			Provides a hint that tracks at and adjacent to @c position are likely to be requested soon,
+			allowing them to be decoded in advance.
+		*/
+		virtual void prefetch_tracks_near(HeadPosition position) {}
+
 		/*!
 			@returns whether the disk image is read only. Defaults to @c true if not overridden.
 		*/
@@ -9,8 +9,11 @@
 #ifndef DiskImage_hpp
 #define DiskImage_hpp
 
+#include <atomic>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "../Disk.hpp"
 #include "../Track/Track.hpp"
@@ -70,10 +73,74 @@ class DiskImage {
 };
 
 class DiskImageHolderBase: public Disk {
+	public:
+		DiskImageHolderBase() : prefetch_generation_(0) {}
+
 	protected:
 		std::set<Track::Address> unwritten_tracks_;
 		std::map<Track::Address, std::shared_ptr<Track>> cached_tracks_;
 		std::unique_ptr<Concurrency::AsyncTaskQueue> update_queue_;
+
+		/// The maximum number of tracks read from the disk image that will be retained in @c cached_tracks_.
+		static const std::size_t MaximumCachedTracks = 64;
+
+		/*!
+			Addresses of the tracks in @c cached_tracks_ that have been read from the disk image, from most to least
+			recently used, and the position of each in that list. Tracks that have been written are omitted so as
+			never to be evicted.
+		*/
+		std::list<Track::Address> least_recently_used_;
+		std::map<Track::Address, std::list<Track::Address>::iterator> least_recently_used_positions_;
+
+		/// Guards @c cached_tracks_ and the least-recently-used list, as tracks may be inserted by a prefetch.
+		std::mutex cache_mutex_;
+
+		/// Serialises access to the disk image between the caller and any prefetch or update in progress.
+		std::mutex disk_image_mutex_;
+
+		/// Marks @c address as most recently used, if it is subject to eviction. The caller should hold @c cache_mutex_.
+		void touch_cached_track(Track::Address address) {
+			auto position = least_recently_used_positions_.find(address);
+			if(position != least_recently_used_positions_.end()) {
+				least_recently_used_.splice(least_recently_used_.begin(), least_recently_used_, position->second);
+			}
+		}
+
+		/*!
+			Adds @c track, as read from the disk image, to the cache unless a track is already cached at @c address,
+			evicting the least recently used tracks as necessary. The caller should hold @c cache_mutex_.
+
+			@returns the track now cached at @c address.
+		*/
+		std::shared_ptr<Track> cache_track(Track::Address address, const std::shared_ptr<Track> &track) {
+			auto existing_track = cached_tracks_.find(address);
+			if(existing_track != cached_tracks_.end()) {
+				touch_cached_track(address);
+				return existing_track->second;
+			}
+
+			cached_tracks_[address] = track;
+			least_recently_used_.push_front(address);
+			least_recently_used_positions_.insert(std::make_pair(address, least_recently_used_.begin()));
+			while(least_recently_used_.size() > MaximumCachedTracks) {
+				cached_tracks_.erase(least_recently_used_.back());
+				least_recently_used_positions_.erase(least_recently_used_.back());
+				least_recently_used_.pop_back();
+			}
+			return track;
+		}
+
+		/// Removes @c address from the least-recently-used list, so that it'll never be evicted.
+		/// The caller should hold @c cache_mutex_.
+		void pin_cached_track(Track::Address address) {
+			auto position = least_recently_used_positions_.find(address);
+			if(position == least_recently_used_positions_.end()) return;
+			least_recently_used_.erase(position->second);
+			least_recently_used_positions_.erase(position);
+		}
+
+		/// Incremented upon every request to prefetch, allowing superseded prefetches to be abandoned.
+		std::atomic<int> prefetch_generation_;
 };
 
 /*!
@@ -93,9 +160,13 @@ template <typename T> class DiskImageHolder: public DiskImageHolderBase {
 		void set_track_at_position(Track::Address address, const std::shared_ptr<Track> &track);
 		void flush_tracks();
 		bool get_is_read_only();
+		void prefetch_tracks_near(HeadPosition position);
 
 	private:
 		T disk_image_;
+
+		std::shared_ptr<Track> get_cached_track(Track::Address address);
+		std::shared_ptr<Track> read_track(Track::Address address);
 };
 
 #include "DiskImageImplementation.hpp"
@@ -24,12 +24,16 @@ template <typename T> void DiskImageHolder<T>::flush_tracks() {
 
 		using TrackMap = std::map<Track::Address, std::shared_ptr<Track>>;
 		std::shared_ptr<TrackMap> track_copies(new TrackMap);
-		for(const auto &address : unwritten_tracks_) {
-			track_copies->insert(std::make_pair(address, std::shared_ptr<Track>(cached_tracks_[address]->clone())));
+		{
+			std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+			for(const auto &address : unwritten_tracks_) {
+				track_copies->insert(std::make_pair(address, std::shared_ptr<Track>(cached_tracks_[address]->clone())));
+			}
 		}
 		unwritten_tracks_.clear();
 
 		update_queue_->enqueue([this, track_copies]() {
+			std::lock_guard<std::mutex> image_lock(disk_image_mutex_);
 			disk_image_.set_tracks(*track_copies);
 		});
 	}
@@ -39,22 +43,69 @@ template <typename T> void DiskImageHolder<T>::set_track_at_position(Track::Addr
 	if(disk_image_.get_is_read_only()) return;
 
 	unwritten_tracks_.insert(address);
+
+	std::lock_guard<std::mutex> cache_lock(cache_mutex_);
 	cached_tracks_[address] = track;
+	pin_cached_track(address);
 }
 
 template <typename T> std::shared_ptr<Track> DiskImageHolder<T>::get_track_at_position(Track::Address address) {
 	if(address.head >= get_head_count()) return nullptr;
 	if(address.position >= get_maximum_head_position()) return nullptr;
 
+	std::shared_ptr<Track> track = get_cached_track(address);
+	if(track) return track;
+	return read_track(address);
+}
+
+template <typename T> std::shared_ptr<Track> DiskImageHolder<T>::get_cached_track(Track::Address address) {
+	std::lock_guard<std::mutex> cache_lock(cache_mutex_);
 	auto cached_track = cached_tracks_.find(address);
-	if(cached_track != cached_tracks_.end()) return cached_track->second;
+	if(cached_track == cached_tracks_.end()) return nullptr;
+	touch_cached_track(address);
+	return cached_track->second;
+}
 
-	std::shared_ptr<Track> track = disk_image_.get_track_at_position(address);
+template <typename T> std::shared_ptr<Track> DiskImageHolder<T>::read_track(Track::Address address) {
+	std::lock_guard<std::mutex> image_lock(disk_image_mutex_);
+
+	// A prefetch may have decoded this track while the disk image was otherwise occupied.
+	std::shared_ptr<Track> track = get_cached_track(address);
+	if(track) return track;
+
+	track = disk_image_.get_track_at_position(address);
 	if(!track) return nullptr;
-	cached_tracks_[address] = track;
-	return track;
+
+	std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+	return cache_track(address, track);
+}
+
+template <typename T> void DiskImageHolder<T>::prefetch_tracks_near(HeadPosition position) {
+	if(!update_queue_) update_queue_.reset(new Concurrency::AsyncTaskQueue);
+
+	// Decode the tracks under every head at this position and one whole track either side, in the
+	// order that they're most likely to be needed. Abandon the work if the head moves again first.
+	const int generation = ++prefetch_generation_;
+	update_queue_->enqueue([this, position, generation]() {
+		const int head_count = get_head_count();
+		const HeadPosition maximum_position = get_maximum_head_position();
+		for(int offset: {0, 4, -4}) {
+			const int quarter = position.as_quarter() + offset;
+			if(quarter < 0) continue;
+
+			HeadPosition adjacent_position(quarter, 4);
+			if(adjacent_position >= maximum_position) continue;
+
+			for(int head = 0; head < head_count; ++head) {
+				if(prefetch_generation_ != generation) return;
+				read_track(Track::Address(head, adjacent_position));
+			}
+		}
+	});
 }
 
 template <typename T> DiskImageHolder<T>::~DiskImageHolder() {
+	// Abandon any outstanding prefetches, so that only pending writes need be waited for.
+	++prefetch_generation_;
 	if(update_queue_) update_queue_->flush();
 }
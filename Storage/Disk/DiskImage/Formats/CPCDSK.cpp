@@ -11,7 +11,6 @@
 #include "../../Encodings/MFM/Constants.hpp"
 #include "../../Encodings/MFM/Encoder.hpp"
 #include "../../Encodings/MFM/SegmentParser.hpp"
-#include "../../Track/TrackSerialiser.hpp"
 
 #include <iostream>
 
@@ -223,9 +222,7 @@ void CPCDSK::set_tracks(const std::map<::Storage::Disk::Track::Address, std::sha
 		// Assume MFM for now; with extensions DSK can contain FM tracks.
 		const bool is_double_density = true;
 		std::map<std::size_t, Storage::Encodings::MFM::Sector> sectors =
-			Storage::Encodings::MFM::sectors_from_segment(
-				Storage::Disk::track_serialisation(*pair.second, is_double_density ? Storage::Encodings::MFM::MFMBitLength : Storage::Encodings::MFM::FMBitLength),
-				is_double_density);
+			Storage::Encodings::MFM::sectors_from_track(*pair.second, is_double_density);
 
 		// Find slot for track, making it if neccessary.
 		std::size_t chronological_track = index_for_track(pair.first);
@@ -8,7 +8,6 @@
 
 #include "G64.hpp"
 
-#include <cstring>
 #include <vector>
 
 #include "../../Track/PCMTrack.hpp"
@@ -17,7 +16,7 @@
 using namespace Storage::Disk;
 
 G64::G64(const std::string &file_name) :
-		file_(file_name) {
+		file_(file_name, FileHolder::FileMode::MappedRead) {
 	// read and check the file signature
 	if(!file_.check_signature("GCR-1541")) throw Error::InvalidFormat;
 
@@ -39,44 +38,32 @@ HeadPosition G64::get_maximum_head_position() {
 std::shared_ptr<Track> G64::get_track_at_position(Track::Address address) {
 	std::shared_ptr<Track> resulting_track;
 
-	// seek to this track's entry in the track table
-	file_.seek(static_cast<long>((address.position.as_half() * 4) + 0xc), SEEK_SET);
-
-	// read the track offset
-	uint32_t track_offset;
-	track_offset = file_.get32le();
+	// read this track's entry in the track table
+	const Storage::FileHolder::Span track_entry = file_.view(static_cast<long>((address.position.as_half() * 4) + 0xc), 4);
+	if(track_entry.size < 4) return resulting_track;
+	const uint32_t track_offset = static_cast<uint32_t>(track_entry[0] | (track_entry[1] << 8) | (track_entry[2] << 16) | (track_entry[3] << 24));
 
 	// if the track offset is zero, this track doesn't exist, so...
 	if(!track_offset) return resulting_track;
 
-	// seek to the track start
-	file_.seek(static_cast<long>(track_offset), SEEK_SET);
-
-	// get the real track length
-	uint16_t track_length;
-	track_length = file_.get16le();
-
-	// grab the byte contents of this track
-	std::vector<uint8_t> track_contents(track_length);
-	file_.read(&track_contents[0], track_length);
+	// get the real track length, and view the byte contents of this track
+	const Storage::FileHolder::Span track_header = file_.view(static_cast<long>(track_offset), 2);
+	if(track_header.size < 2) return resulting_track;
+	const uint16_t track_length = static_cast<uint16_t>(track_header[0] | (track_header[1] << 8));
+	const Storage::FileHolder::Span track_contents = file_.view(static_cast<long>(track_offset) + 2, track_length);
+	if(track_contents.size < track_length) return resulting_track;
 
-	// seek to this track's entry in the speed zone table
-	file_.seek(static_cast<long>((address.position.as_half() * 4) + 0x15c), SEEK_SET);
-
-	// read the speed zone offsrt
-	uint32_t speed_zone_offset;
-	speed_zone_offset = file_.get32le();
+	// read this track's entry in the speed zone table
+	const Storage::FileHolder::Span speed_zone_entry = file_.view(static_cast<long>((address.position.as_half() * 4) + 0x15c), 4);
+	if(speed_zone_entry.size < 4) return resulting_track;
+	const uint32_t speed_zone_offset = static_cast<uint32_t>(speed_zone_entry[0] | (speed_zone_entry[1] << 8) | (speed_zone_entry[2] << 16) | (speed_zone_entry[3] << 24));
 
 	// if the speed zone is not constant, create a track based on the whole table; otherwise create one that's constant
 	if(speed_zone_offset > 3) {
-		// seek to start of speed zone
-		file_.seek(static_cast<long>(speed_zone_offset), SEEK_SET);
-
-		uint16_t speed_zone_length = (track_length + 3) >> 2;
-
-		// read the speed zone bytes
-		uint8_t speed_zone_contents[speed_zone_length];
-		file_.read(speed_zone_contents, speed_zone_length);
+		// view the speed zone bytes
+		const uint16_t speed_zone_length = (track_length + 3) >> 2;
+		const Storage::FileHolder::Span speed_zone_contents = file_.view(static_cast<long>(speed_zone_offset), speed_zone_length);
+		if(speed_zone_contents.size < speed_zone_length) return resulting_track;
 
 		// divide track into appropriately timed PCMSegments
 		std::vector<PCMSegment> segments;
@@ -90,8 +77,7 @@ std::shared_ptr<Track> G64::get_track_at_position(Track::Address address) {
 				PCMSegment segment;
 				segment.number_of_bits = number_of_bytes * 8;
 				segment.length_of_a_bit = Encodings::CommodoreGCR::length_of_a_bit_in_time_zone(current_speed);
-				segment.data.resize(number_of_bytes);
-				std::memcpy(&segment.data[0], &track_contents[start_byte_in_current_speed], number_of_bytes);
+				segment.data.assign(track_contents.data + start_byte_in_current_speed, track_contents.data + start_byte_in_current_speed + number_of_bytes);
 				segments.push_back(std::move(segment));
 
 				current_speed = byte_speed;
@@ -104,7 +90,7 @@ std::shared_ptr<Track> G64::get_track_at_position(Track::Address address) {
 		PCMSegment segment;
 		segment.number_of_bits = track_length * 8;
 		segment.length_of_a_bit = Encodings::CommodoreGCR::length_of_a_bit_in_time_zone(static_cast<unsigned int>(speed_zone_offset));
-		segment.data = std::move(track_contents);
+		segment.data.assign(track_contents.begin(), track_contents.end());
 
 		resulting_track.reset(new PCMTrack(std::move(segment)));
 	}
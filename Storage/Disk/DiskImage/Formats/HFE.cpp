@@ -8,6 +8,8 @@
 
 #include "HFE.hpp"
 
+#include <cstring>
+
 #include "../../Track/PCMTrack.hpp"
 #include "../../Track/TrackSerialiser.hpp"
 #include "../../../Data/BitReverse.hpp"
@@ -62,17 +64,25 @@ std::shared_ptr<Track> HFE::get_track_at_position(Track::Address address) {
 	PCMSegment segment;
 	{
 		std::lock_guard<std::mutex> lock_guard(file_.get_file_access_mutex());
-		uint16_t track_length = seek_track(address);
 
+		// Get track position and length from the lookup table, then copy the track straight out of
+		// the file; it is in 256-byte blocks that alternate between the two heads.
+		const Storage::FileHolder::Span entry = file_.view(track_list_offset_ + address.position.as_int() * 4, 4);
+		if(entry.size < 4) return nullptr;
+		const long track_offset = static_cast<long>(entry[0] | (entry[1] << 8)) << 9;
+		const uint16_t track_length = static_cast<uint16_t>((entry[2] | (entry[3] << 8)) / 2);
+
+		const Storage::FileHolder::Span track = file_.view(track_offset + (address.head ? 256 : 0), static_cast<std::size_t>(track_length) * 2);
 		segment.data.resize(track_length);
 		segment.number_of_bits = track_length * 8;
 
 		uint16_t c = 0;
 		while(c < track_length) {
-			uint16_t length = static_cast<uint16_t>(std::min(256, track_length - c));
-			file_.read(&segment.data[c], length);
+			const std::size_t source = static_cast<std::size_t>(c) * 2;
+			if(source >= track.size) break;
+			const uint16_t length = static_cast<uint16_t>(std::min(std::min(256, track_length - c), static_cast<int>(track.size - source)));
+			std::memcpy(&segment.data[c], &track.data[source], length);
 			c += length;
-			file_.seek(256, SEEK_CUR);
 		}
 	}
 
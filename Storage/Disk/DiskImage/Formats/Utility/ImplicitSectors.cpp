@@ -12,8 +12,6 @@
 
 #include "../../../Encodings/MFM/Sector.hpp"
 #include "../../../Encodings/MFM/Encoder.hpp"
-#include "../../../Encodings/MFM/Constants.hpp"
-#include "../../../Track/TrackSerialiser.hpp"
 #include "../../../Encodings/MFM/SegmentParser.hpp"
 
 using namespace Storage::Disk;
@@ -47,9 +45,7 @@ std::shared_ptr<Track> Storage::Disk::track_for_sectors(uint8_t *const source, i
 
 void Storage::Disk::decode_sectors(Track &track, uint8_t *const destination, uint8_t first_sector, uint8_t last_sector, uint8_t sector_size, bool is_double_density) {
 	std::map<std::size_t, Storage::Encodings::MFM::Sector> sectors =
-		Storage::Encodings::MFM::sectors_from_segment(
-			Storage::Disk::track_serialisation(track, is_double_density ? Storage::Encodings::MFM::MFMBitLength : Storage::Encodings::MFM::FMBitLength),
-			is_double_density);
+		Storage::Encodings::MFM::sectors_from_track(track, is_double_density);
 
 	std::size_t byte_size = static_cast<std::size_t>(128 << sector_size);
 	for(const auto &pair : sectors) {
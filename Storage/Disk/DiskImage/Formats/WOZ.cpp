@@ -8,12 +8,14 @@
 
 #include "WOZ.hpp"
 
+#include <algorithm>
+
 #include "../../Track/PCMTrack.hpp"
 
 using namespace Storage::Disk;
 
 WOZ::WOZ(const std::string &file_name) :
-	file_(file_name) {
+	file_(file_name, FileHolder::FileMode::MappedRead) {
 
 	const char signature[8] = {
 		'W', 'O', 'Z', '1',
@@ -82,15 +84,18 @@ std::shared_ptr<Track> WOZ::get_track_at_position(Track::Address address) {
 	const int table_position = address.head * (is_3_5_disk_ ? 80 : 160) + (is_3_5_disk_ ? address.position.as_int() : address.position.as_quarter());
 	if(track_map_[table_position] == 0xff) return nullptr;
 
-	// Seek to the real track.
-	file_.seek(tracks_offset_ + track_map_[table_position] * 6656, SEEK_SET);
+	// View the real track: 6646 bytes of data, followed by the number of those bytes that are
+	// in use, the number of bits, and the splice point.
+	const Storage::FileHolder::Span track = file_.view(tracks_offset_ + track_map_[table_position] * 6656, 6652);
+	if(track.size < 6652) return nullptr;
 
 	PCMSegment track_contents;
-	track_contents.data = file_.read(6646);
-	track_contents.data.resize(file_.get16le());
-	track_contents.number_of_bits = file_.get16le();
+	const uint16_t bytes_used = static_cast<uint16_t>(track[6646] | (track[6647] << 8));
+	track_contents.data.assign(track.begin(), track.begin() + std::min(bytes_used, static_cast<uint16_t>(6646)));
+	track_contents.data.resize(bytes_used);
+	track_contents.number_of_bits = static_cast<unsigned int>(track[6648] | (track[6649] << 8));
 
-	const uint16_t splice_point = file_.get16le();
+	const uint16_t splice_point = static_cast<uint16_t>(track[6650] | (track[6651] << 8));
 	if(splice_point != 0xffff) {
 		// TODO: expand track from splice_point?
 	}
@@ -49,6 +49,10 @@ void Drive::set_disk(const std::shared_ptr<Disk> &disk) {
 	update_sleep_observer();
 }
 
+const std::shared_ptr<Disk> &Drive::get_disk() {
+	return disk_;
+}
+
 bool Drive::has_disk() {
 	return has_disk_;
 }
@@ -71,9 +75,10 @@ void Drive::step(HeadPosition offset) {
 		if(observer_) observer_->announce_drive_event(drive_name_, Activity::Observer::DriveEvent::StepNormal);
 	}
 
-	// If the head moved, flush the old track.
+	// If the head moved, flush the old track and give the disk a chance to get ahead on the new one.
 	if(head_position_ != old_head_position) {
 		track_ = nullptr;
+		if(disk_) disk_->prefetch_tracks_near(head_position_);
 	}
 }
 
@@ -107,13 +112,7 @@ bool Drive::get_is_ready() {
 
 void Drive::set_motor_on(bool motor_is_on) {
 	motor_is_on_ = motor_is_on;
-
-	if(observer_) {
-		observer_->set_drive_motor_status(drive_name_, motor_is_on_);
-		if(announce_motor_led_) {
-			observer_->set_led_status(drive_name_, motor_is_on_);
-		}
-	}
+	announce_motor_status();
 
 	if(!motor_is_on) {
 		ready_index_count_ = 0;
@@ -320,6 +319,15 @@ void Drive::end_writing() {
 	}
 }
 
+void Drive::announce_motor_status() {
+	if(observer_) {
+		observer_->set_drive_motor_status(drive_name_, motor_is_on_);
+		if(announce_motor_led_) {
+			observer_->set_led_status(drive_name_, motor_is_on_);
+		}
+	}
+}
+
 void Drive::set_activity_observer(Activity::Observer *observer, const std::string &name, bool add_motor_led) {
 	observer_ = observer;
 	announce_motor_led_ = add_motor_led;
@@ -335,3 +343,33 @@ void Drive::set_activity_observer(Activity::Observer *observer, const std::strin
 		}
 	}
 }
+
+// MARK: - State
+
+void Drive::serialise(State::Archive &archive) {
+	archive.tag("Drive");
+	TimedEventLoop::serialise(archive);
+	archive(head_position_, head_, motor_is_on_, cycles_since_index_hole_, ready_index_count_);
+	archive(current_event_, random_source_, random_interval_);
+	archive(is_reading_, clamp_writing_to_index_hole_, write_start_time_, cycles_until_bits_written_, cycles_per_bit_);
+	archive(write_segment_.length_of_a_bit, write_segment_.number_of_bits);
+	archive.vector(write_segment_.data);
+	if(archive.is_saving() || !archive.is_valid()) return;
+
+	// Drop the current track; the restored event will be posted as normal, after which
+	// get_next_event will seek within the track under the restored head position.
+	invalidate_track();
+
+	// A write in progress needs a track to patch once it ends.
+	if(!is_reading_) {
+		std::shared_ptr<Track> track = get_track();
+		if(!track) track.reset(new UnformattedTrack);
+		patched_track_ = std::dynamic_pointer_cast<PCMPatchedTrack>(track);
+		if(!patched_track_) {
+			patched_track_.reset(new PCMPatchedTrack(track));
+		}
+	}
+
+	announce_motor_status();
+	update_sleep_observer();
+}
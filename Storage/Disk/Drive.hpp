@@ -32,6 +32,11 @@ class Drive: public Sleeper, public TimedEventLoop {
 		*/
 		void set_disk(const std::shared_ptr<Disk> &disk);
 
+		/*!
+			@returns The disk currently in the drive, or @c nullptr if there is none.
+		*/
+		const std::shared_ptr<Disk> &get_disk();
+
 		/*!
 			@returns @c true if a disk is currently inserted; @c false otherwise.
 		*/
@@ -127,6 +132,15 @@ class Drive: public Sleeper, public TimedEventLoop {
 		/// The caller can specify whether to add an LED based on disk motor.
 		void set_activity_observer(Activity::Observer *observer, const std::string &name, bool add_motor_led);
 
+		/*!
+			Records or restores the head position, motor state, rotational position and any write in progress.
+			The disk itself is not included.
+
+			Upon restoration the drive resynchronises to the track under the head at the next scheduled event,
+			so flux timing thereafter may differ very slightly from that of the original run.
+		*/
+		void serialise(State::Archive &archive);
+
 	private:
 		// Drives contain an entire disk; from that a certain track
 		// will be currently under the head.
@@ -196,6 +210,7 @@ class Drive: public Sleeper, public TimedEventLoop {
 		void invalidate_track();
 
 		// Activity observer description.
+		void announce_motor_status();
 		Activity::Observer *observer_ = nullptr;
 		std::string drive_name_;
 		bool announce_motor_led_ = false;
@@ -9,6 +9,7 @@
 #include "Encoder.hpp"
 
 #include "Constants.hpp"
+#include "SegmentParser.hpp"
 #include "../../Track/PCMTrack.hpp"
 #include "../../../../NumberTheory/CRC.hpp"
 
@@ -19,6 +20,7 @@ using namespace Storage::Encodings::MFM;
 class MFMEncoder: public Encoder {
 	public:
 		MFMEncoder(std::vector<uint8_t> &target) : Encoder(target) {}
+		static const bool IsDoubleDensity = true;
 
 		void add_byte(uint8_t input) {
 			crc_generator_.add(input);
@@ -75,6 +77,7 @@ class FMEncoder: public Encoder {
 	// encodes each 16-bit part as clock, data, clock, data [...]
 	public:
 		FMEncoder(std::vector<uint8_t> &target) : Encoder(target) {}
+		static const bool IsDoubleDensity = false;
 
 		void add_byte(uint8_t input) {
 			crc_generator_.add(input);
@@ -130,6 +133,17 @@ template<class T> std::shared_ptr<Storage::Disk::Track>
 	segment.data.reserve(expected_track_bytes);
 	T shifter(segment.data);
 
+	// Keep a note of each sector as it is encoded, along with the position of its ID mark and of the end of
+	// its data, so that whichever survive any truncation below can be published with the track. Sizes
+	// above 7 are encoded differently from how they'd be parsed, so tracks with any aren't published.
+	struct EncodedSector {
+		const Sector *sector;
+		std::size_t id_position;
+		std::size_t end_of_data;
+	};
+	std::vector<EncodedSector> encoded_sectors;
+	bool can_publish_sectors = true;
+
 	// output the index mark
 	shifter.add_index_address_mark();
 
@@ -143,6 +157,7 @@ template<class T> std::shared_ptr<Storage::Disk::Track>
 
 		// sector header
 		shifter.add_ID_address_mark();
+		const std::size_t id_position = segment.data.size() * 8 - 1;
 		shifter.add_byte(sector->address.track);
 		shifter.add_byte(sector->address.side);
 		shifter.add_byte(sector->address.sector);
@@ -169,8 +184,10 @@ template<class T> std::shared_ptr<Storage::Disk::Track>
 			for(; c < declared_length; c++) {
 				shifter.add_byte(0x00);
 			}
+			encoded_sectors.push_back({sector, id_position, segment.data.size()});
 			shifter.add_crc(sector->has_data_crc_error);
 		}
+		can_publish_sectors &= sector->size <= 7;
 
 		// gap
 		for(std::size_t c = 0; c < post_data_bytes; c++) shifter.add_byte(post_data_value);
@@ -183,7 +200,30 @@ template<class T> std::shared_ptr<Storage::Disk::Track>
 	if(segment.data.size() > max_size) segment.data.resize(max_size);
 
 	segment.number_of_bits = static_cast<unsigned int>(segment.data.size() * 8);
-	return std::shared_ptr<Storage::Disk::Track>(new Storage::Disk::PCMTrack(std::move(segment)));
+	Storage::Disk::PCMTrack *const track = new Storage::Disk::PCMTrack(std::move(segment));
+
+	if(can_publish_sectors) {
+		std::shared_ptr<DecodedSectors> decoded_sectors(new DecodedSectors);
+		decoded_sectors->is_double_density = T::IsDoubleDensity;
+		for(const auto &encoded_sector: encoded_sectors) {
+			if(encoded_sector.end_of_data > max_size) break;
+
+			// Only the first sample is encoded, adjusted to the declared length.
+			Sector sector;
+			sector.address = encoded_sector.sector->address;
+			sector.size = encoded_sector.sector->size;
+			sector.has_data_crc_error = encoded_sector.sector->has_data_crc_error;
+			sector.has_header_crc_error = encoded_sector.sector->has_header_crc_error;
+			sector.is_deleted = encoded_sector.sector->is_deleted;
+			sector.samples.emplace_back(encoded_sector.sector->samples[0]);
+			sector.samples[0].resize(static_cast<std::size_t>(128 << sector.size), 0x00);
+
+			decoded_sectors->sectors.insert(std::make_pair(encoded_sector.id_position, std::move(sector)));
+		}
+		track->set_decoded_sectors(decoded_sectors);
+	}
+
+	return std::shared_ptr<Storage::Disk::Track>(track);
 }
 
 Encoder::Encoder(std::vector<uint8_t> &target) :
@@ -8,8 +8,6 @@
 
 #include "Parser.hpp"
 
-#include "Constants.hpp"
-#include "../../Track/TrackSerialiser.hpp"
 #include "SegmentParser.hpp"
 
 using namespace Storage::Encodings::MFM;
@@ -27,9 +25,7 @@ void Parser::install_sectors_from_track(const Storage::Disk::Track::Address &add
 		return;
 	}
 
-	std::map<std::size_t, Sector> sectors = sectors_from_segment(
-		Storage::Disk::track_serialisation(*track, is_mfm_ ? MFMBitLength : FMBitLength),
-		is_mfm_);
+	std::map<std::size_t, Sector> sectors = sectors_from_track(*track, is_mfm_);
 
 	std::map<int, Storage::Encodings::MFM::Sector> sectors_by_id;
 	for(const auto &sector : sectors) {
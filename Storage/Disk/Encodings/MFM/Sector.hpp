@@ -45,6 +45,14 @@ struct Sector {
 
 	Sector() noexcept {}
 
+	Sector(const Sector &rhs) :
+		address(rhs.address),
+		size(rhs.size),
+		samples(rhs.samples),
+		has_data_crc_error(rhs.has_data_crc_error),
+		has_header_crc_error(rhs.has_header_crc_error),
+		is_deleted(rhs.is_deleted ){}
+
 	Sector(const Sector &&rhs) noexcept :
 		address(rhs.address),
 		size(rhs.size),
@@ -7,7 +7,9 @@
 //
 
 #include "SegmentParser.hpp"
+#include "Constants.hpp"
 #include "Shifter.hpp"
+#include "../../Track/TrackSerialiser.hpp"
 
 using namespace Storage::Encodings::MFM;
 
@@ -80,3 +82,14 @@ std::map<std::size_t, Storage::Encodings::MFM::Sector> Storage::Encodings::MFM::
 
 	return result;
 }
+
+std::map<std::size_t, Storage::Encodings::MFM::Sector> Storage::Encodings::MFM::sectors_from_track(Storage::Disk::Track &track, bool is_double_density) {
+	const std::shared_ptr<const DecodedSectors> decoded_sectors = track.get_decoded_sectors();
+	if(decoded_sectors && decoded_sectors->is_double_density == is_double_density) {
+		return decoded_sectors->sectors;
+	}
+
+	return sectors_from_segment(
+		Storage::Disk::track_serialisation(track, is_double_density ? MFMBitLength : FMBitLength),
+		is_double_density);
+}
@@ -11,6 +11,7 @@
 
 #include "Sector.hpp"
 #include "../../Track/PCMSegment.hpp"
+#include "../../Track/Track.hpp"
 #include <map>
 
 namespace Storage {
@@ -24,6 +25,24 @@ namespace MFM {
 */
 std::map<std::size_t, Sector> sectors_from_segment(const Disk::PCMSegment &&segment, bool is_double_density);
 
+/*!
+	The sectors from which a track was built, as published by tracks via @c Track::get_decoded_sectors.
+	These are the sectors that @c sectors_from_segment would find, in the same order, except that CRC error
+	flags are retained. Keys are positions within the track as encoded, which are the positions that
+	@c sectors_from_segment would report only if the track is of nominal length.
+*/
+struct DecodedSectors {
+	bool is_double_density = true;
+	std::map<std::size_t, Sector> sectors;
+};
+
+/*!
+	Obtains all sectors included on @c track, as per @c sectors_from_segment. If the track publishes
+	the sectors it was built from then they are returned directly; otherwise the track is serialised
+	and parsed.
+*/
+std::map<std::size_t, Sector> sectors_from_track(Disk::Track &track, bool is_double_density);
+
 }
 }
 }
@@ -118,3 +118,12 @@ uint8_t Shifter::get_byte() const {
 		((shift_register_ & 0x1000) >> 6) |
 		((shift_register_ & 0x4000) >> 7));
 }
+
+void Shifter::serialise(State::Archive &archive) {
+	archive(bits_since_token_, shift_register_, is_awaiting_marker_value_, should_obey_syncs_, token_, is_double_density_);
+	if(owned_crc_generator_) {
+		uint16_t crc = owned_crc_generator_->get_value();
+		archive(crc);
+		owned_crc_generator_->set_value(crc);
+	}
+}
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <memory>
 #include "../../../../NumberTheory/CRC.hpp"
+#include "../../../../State/Archive.hpp"
 
 namespace Storage {
 namespace Encodings {
@@ -61,6 +62,9 @@ class Shifter {
 			return *crc_generator_;
 		}
 
+		/// Records or restores the shift register and token state, and the CRC if this shifter owns its generator.
+		void serialise(State::Archive &archive);
+
 	private:
 		// Bit stream input state
 		int bits_since_token_ = 0;
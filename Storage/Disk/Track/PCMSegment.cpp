@@ -8,10 +8,68 @@
 
 #include "PCMSegment.hpp"
 
+#include <algorithm>
+
 using namespace Storage::Disk;
 
+namespace {
+
+/// @returns the number of leading zero bits in @c value, which must be non-zero.
+int leading_zeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_clzll(value);
+#else
+	int count = 0;
+	while(!(value & 0x8000000000000000)) {
+		value <<= 1;
+		++count;
+	}
+	return count;
+#endif
+}
+
+/// @returns the number of leading zero bits in @c value, which must be non-zero.
+int leading_zeros(uint8_t value) {
+	return leading_zeros(static_cast<uint64_t>(value)) - 56;
+}
+
+/*!
+	@returns the offset of the first set bit in @c data at or after @c from but before @c limit,
+	or @c limit if there is none. Bits are taken MSB to LSB, and zeroes are skipped a word at a time.
+*/
+std::size_t next_set_bit(const uint8_t *data, std::size_t from, std::size_t limit) {
+	if(from >= limit) return limit;
+	std::size_t byte = from >> 3;
+	const std::size_t end_byte = (limit + 7) >> 3;
+
+	// Check the remainder of the byte that contains from.
+	if(from & 7) {
+		const uint8_t bits = static_cast<uint8_t>(data[byte] & (0xff >> (from & 7)));
+		if(bits) return std::min(limit, (byte << 3) + static_cast<std::size_t>(leading_zeros(bits)));
+		++byte;
+	}
+
+	// Then proceed in whole 64-bit words for as long as possible.
+	while(byte + 8 <= end_byte) {
+		uint64_t word = 0;
+		for(std::size_t c = 0; c < 8; ++c) word = (word << 8) | data[byte + c];
+		if(word) return std::min(limit, (byte << 3) + static_cast<std::size_t>(leading_zeros(word)));
+		byte += 8;
+	}
+
+	// Then any bytes left over.
+	while(byte < end_byte) {
+		if(data[byte]) return std::min(limit, (byte << 3) + static_cast<std::size_t>(leading_zeros(data[byte])));
+		++byte;
+	}
+	return limit;
+}
+
+}
+
 PCMSegmentEventSource::PCMSegmentEventSource(const PCMSegment &segment) :
-		segment_(new PCMSegment(segment)) {
+		segment_(new PCMSegment(segment)),
+		flux_index_(new FluxIndex) {
 	// add an extra bit of storage at the bottom if one is going to be needed;
 	// events returned are going to be in integral multiples of the length of a bit
 	// other than the very first and very last which will include a half bit length
@@ -28,8 +86,9 @@ PCMSegmentEventSource::PCMSegmentEventSource(const PCMSegment &segment) :
 }
 
 PCMSegmentEventSource::PCMSegmentEventSource(const PCMSegmentEventSource &original) {
-	// share underlying data with the original
+	// share underlying data, and any index of it, with the original
 	segment_ = original.segment_;
+	flux_index_ = original.flux_index_;
 
 	// load up the clock rate and set initial conditions
 	next_event_.length.clock_rate = segment_->length_of_a_bit.clock_rate;
@@ -40,9 +99,47 @@ void PCMSegmentEventSource::reset() {
 	// start with the first bit to be considered the zeroth, and assume that it'll be
 	// flux transitions for the foreseeable
 	bit_pointer_ = 0;
+	flux_pointer_ = 0;
 	next_event_.type = Track::Event::FluxTransition;
 }
 
+void PCMSegmentEventSource::build_flux_index() {
+	// Copies of this source may be used on other threads, so build the index only once and
+	// announce it only once it is complete.
+	FluxIndex &flux_index = *flux_index_;
+	std::call_once(flux_index.build_flag, [this, &flux_index] {
+		std::vector<unsigned int> offsets;
+		const std::size_t number_of_bits = segment_->number_of_bits;
+		std::size_t offset = next_set_bit(segment_->data.data(), 0, number_of_bits);
+		while(offset < number_of_bits) {
+			offsets.push_back(static_cast<unsigned int>(offset));
+			offset = next_set_bit(segment_->data.data(), offset + 1, number_of_bits);
+		}
+
+		flux_index.offsets = std::move(offsets);
+		flux_index.is_built.store(true, std::memory_order_release);
+	});
+}
+
+std::size_t PCMSegmentEventSource::next_flux_transition() {
+	if(!flux_index_->is_built.load(std::memory_order_acquire)) {
+		return next_set_bit(segment_->data.data(), bit_pointer_, segment_->number_of_bits);
+	}
+
+	// flux_pointer_ should identify the first transition at or after bit_pointer_; it'll need
+	// to be found afresh after a seek, or if the index was built by another source sharing it.
+	const std::vector<unsigned int> &offsets = flux_index_->offsets;
+	if(
+		(flux_pointer_ < offsets.size() && offsets[flux_pointer_] < bit_pointer_) ||
+		(flux_pointer_ > 0 && offsets[flux_pointer_ - 1] >= bit_pointer_)
+	) {
+		flux_pointer_ = static_cast<std::size_t>(std::lower_bound(offsets.begin(), offsets.end(), bit_pointer_) - offsets.begin());
+	}
+
+	if(flux_pointer_ == offsets.size()) return segment_->number_of_bits;
+	return offsets[flux_pointer_++];
+}
+
 PCMSegment &PCMSegment::operator +=(const PCMSegment &rhs) {
 	if(!rhs.number_of_bits) return *this;
 
@@ -78,15 +175,15 @@ Storage::Disk::Track::Event PCMSegmentEventSource::get_next_event() {
 	// is set, it should be in the centre of its window
 	next_event_.length.length = bit_pointer_ ? 0 : -(segment_->length_of_a_bit.length >> 1);
 
-	// search for the next bit that is set, if any
-	const uint8_t *segment_data = segment_->data.data();
-	while(bit_pointer_ < segment_->number_of_bits) {
-		int bit = segment_data[bit_pointer_ >> 3] & (0x80 >> (bit_pointer_&7));
-		bit_pointer_++;	// so this always points one beyond the most recent bit returned
-		next_event_.length.length += segment_->length_of_a_bit.length;
+	// find the next bit that is set, if any
+	if(bit_pointer_ < segment_->number_of_bits) {
+		const std::size_t next_bit = next_flux_transition();
+		const std::size_t end = std::min(next_bit + 1, static_cast<std::size_t>(segment_->number_of_bits));
+		next_event_.length.length += static_cast<unsigned int>(end - bit_pointer_) * segment_->length_of_a_bit.length;
+		bit_pointer_ = end;	// so this always points one beyond the most recent bit returned
 
-		// if this bit is set, return the event
-		if(bit) return next_event_;
+		// if a set bit was found, return the event
+		if(next_bit < segment_->number_of_bits) return next_event_;
 	}
 
 	// if the end is reached without a bit being set, it'll be index holes from now on
@@ -108,6 +205,8 @@ Storage::Time PCMSegmentEventSource::get_length() {
 }
 
 Storage::Time PCMSegmentEventSource::seek_to(const Time &time_from_start) {
+	build_flux_index();
+
 	// test for requested time being beyond the end
 	Time length = get_length();
 	if(time_from_start >= length) {
@@ -9,8 +9,10 @@
 #ifndef PCMSegment_hpp
 #define PCMSegment_hpp
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "../../Storage.hpp"
@@ -90,6 +92,26 @@ class PCMSegmentEventSource {
 		std::shared_ptr<PCMSegment> segment_;
 		std::size_t bit_pointer_;
 		Track::Event next_event_;
+
+		/*!
+			The offsets of every set bit within the segment, allowing the next event to be found without
+			scanning. It is built upon the first seek and is shared with any copies of this source, which
+			may be on other threads; @c offsets may be used only once @c is_built is set.
+		*/
+		struct FluxIndex {
+			std::once_flag build_flag;
+			std::atomic<bool> is_built;
+			std::vector<unsigned int> offsets;
+
+			FluxIndex() : is_built(false) {}
+		};
+		std::shared_ptr<FluxIndex> flux_index_;
+		std::size_t flux_pointer_ = 0;
+
+		void build_flux_index();
+
+		/// @returns the offset of the first set bit at or after @c bit_pointer_, or the segment's length if there is none.
+		std::size_t next_flux_transition();
 };
 
 }
@@ -44,12 +44,21 @@ PCMTrack::PCMTrack(const PCMSegment &segment) : PCMTrack() {
 
 PCMTrack::PCMTrack(const PCMTrack &original) : PCMTrack() {
 	segment_event_sources_ = original.segment_event_sources_;
+	decoded_sectors_ = original.decoded_sectors_;
 }
 
 Track *PCMTrack::clone() {
 	return new PCMTrack(*this);
 }
 
+void PCMTrack::set_decoded_sectors(const std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> &sectors) {
+	decoded_sectors_ = sectors;
+}
+
+std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> PCMTrack::get_decoded_sectors() {
+	return decoded_sectors_;
+}
+
 Track::Event PCMTrack::get_next_event() {
 	// ask the current segment for a new event
 	Track::Event event = segment_event_sources_[segment_pointer_].get_next_event();
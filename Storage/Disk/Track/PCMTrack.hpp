@@ -41,10 +41,17 @@ class PCMTrack: public Track {
 		*/
 		PCMTrack(const PCMTrack &);
 
+		/*!
+			Records that this track was built from @c sectors, which will subsequently be returned by
+			@c get_decoded_sectors.
+		*/
+		void set_decoded_sectors(const std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> &sectors);
+
 		// as per @c Track
 		Event get_next_event();
 		Time seek_to(const Time &time_since_index_hole);
 		Track *clone();
+		std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> get_decoded_sectors();
 
 	private:
 		// storage for the segments that describe this track
@@ -53,6 +60,9 @@ class PCMTrack: public Track {
 		// a pointer to the first bit to consider as the next event
 		std::size_t segment_pointer_;
 
+		// the sectors from which this track was built, if any
+		std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> decoded_sectors_;
+
 		PCMTrack();
 };
 
@@ -10,9 +10,16 @@
 #define Track_h
 
 #include "../../Storage.hpp"
+#include <memory>
 #include <tuple>
 
 namespace Storage {
+namespace Encodings {
+namespace MFM {
+	struct DecodedSectors;
+}
+}
+
 namespace Disk {
 
 /*!
@@ -115,6 +122,15 @@ class Track {
 			The virtual copy constructor pattern; returns a copy of the Track.
 		*/
 		virtual Track *clone() = 0;
+
+		/*!
+			@returns the [M]FM sectors from which this track was built, if it was built from sector contents and
+			is known to be unmodified since; @c nullptr otherwise. Parsers may use these in preference to decoding
+			the track.
+		*/
+		virtual std::shared_ptr<const Storage::Encodings::MFM::DecodedSectors> get_decoded_sectors() {
+			return nullptr;
+		}
 };
 
 }
@@ -11,9 +11,12 @@
 #include <algorithm>
 #include <cstring>
 
+#include <sys/mman.h>
+
 using namespace Storage;
 
 FileHolder::~FileHolder() {
+	unmap();
 	if(file_) std::fclose(file_);
 }
 
@@ -36,74 +39,139 @@ FileHolder::FileHolder(const std::string &file_name, FileMode ideal_mode)
 		case FileMode::Rewrite:
 			file_ = std::fopen(file_name.c_str(), "w");
 		break;
+
+		case FileMode::MappedRead:
+			file_ = std::fopen(file_name.c_str(), "rb");
+			if(!file_) break;
+			is_read_only_ = true;
+
+			// Once mapped there's no further need for the file itself.
+			map();
+			std::fclose(file_);
+			file_ = nullptr;
+		return;
 	}
 
 	if(!file_) throw Error::CantOpen;
 }
 
+void FileHolder::map() {
+	// A shared mapping of the same length as the file is already up to date.
+	struct stat descriptor_stats;
+	const int descriptor = fileno(file_);
+	fstat(descriptor, &descriptor_stats);
+	const std::size_t size = static_cast<std::size_t>(descriptor_stats.st_size);
+	if(has_mapping_ && mapping_is_shared_ && size == mapping_size_) return;
+
+	unmap();
+	has_mapping_ = true;
+	mapping_size_ = size;
+	if(!size) return;
+
+	void *const mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+	if(mapping != MAP_FAILED) {
+		mapping_ = static_cast<const uint8_t *>(mapping);
+		mapping_is_shared_ = true;
+		return;
+	}
+
+	// If the file can't be mapped, take a copy instead, leaving the stdio cursor where it was.
+	const long position = std::ftell(file_);
+	contents_.resize(size);
+	std::fseek(file_, 0, SEEK_SET);
+	contents_.resize(std::fread(contents_.data(), 1, size, file_));
+	std::fseek(file_, position, SEEK_SET);
+	mapping_ = contents_.data();
+	mapping_size_ = contents_.size();
+}
+
+void FileHolder::unmap() {
+	if(mapping_is_shared_) munmap(const_cast<uint8_t *>(mapping_), mapping_size_);
+	contents_.clear();
+	mapping_ = nullptr;
+	mapping_size_ = 0;
+	has_mapping_ = mapping_is_shared_ = false;
+}
+
+FileHolder::Span FileHolder::view(long offset, std::size_t length) {
+	if(file_ && (!has_mapping_ || has_unflushed_writes_)) {
+		if(has_unflushed_writes_) std::fflush(file_);
+		has_unflushed_writes_ = false;
+		map();
+	}
+
+	Span span;
+	if(offset < 0 || static_cast<std::size_t>(offset) >= mapping_size_) return span;
+	span.data = mapping_ + offset;
+	span.size = std::min(length, mapping_size_ - static_cast<std::size_t>(offset));
+	return span;
+}
+
 uint32_t FileHolder::get32le() {
-    uint32_t result = static_cast<uint32_t>(std::fgetc(file_));
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 8;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 16;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 24;
+    uint32_t result = static_cast<uint32_t>(get_byte());
+    result |= static_cast<uint32_t>(get_byte()) << 8;
+    result |= static_cast<uint32_t>(get_byte()) << 16;
+    result |= static_cast<uint32_t>(get_byte()) << 24;
 
     return result;
 }
 
 uint32_t FileHolder::get32be() {
-    uint32_t result = static_cast<uint32_t>(std::fgetc(file_)) << 24;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 16;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 8;
-    result |= static_cast<uint32_t>(std::fgetc(file_));
+    uint32_t result = static_cast<uint32_t>(get_byte()) << 24;
+    result |= static_cast<uint32_t>(get_byte()) << 16;
+    result |= static_cast<uint32_t>(get_byte()) << 8;
+    result |= static_cast<uint32_t>(get_byte());
 
     return result;
 }
 
 uint32_t FileHolder::get24le() {
-    uint32_t result = static_cast<uint32_t>(std::fgetc(file_));
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 8;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 16;
+    uint32_t result = static_cast<uint32_t>(get_byte());
+    result |= static_cast<uint32_t>(get_byte()) << 8;
+    result |= static_cast<uint32_t>(get_byte()) << 16;
 
     return result;
 }
 
 uint32_t FileHolder::get24be() {
-    uint32_t result = static_cast<uint32_t>(std::fgetc(file_)) << 16;
-    result |= static_cast<uint32_t>(std::fgetc(file_)) << 8;
-    result |= static_cast<uint32_t>(std::fgetc(file_));
+    uint32_t result = static_cast<uint32_t>(get_byte()) << 16;
+    result |= static_cast<uint32_t>(get_byte()) << 8;
+    result |= static_cast<uint32_t>(get_byte());
 
     return result;
 }
 
 uint16_t FileHolder::get16le() {
-    uint16_t result = static_cast<uint16_t>(std::fgetc(file_));
-    result |= static_cast<uint16_t>(static_cast<uint16_t>(std::fgetc(file_)) << 8);
+    uint16_t result = static_cast<uint16_t>(get_byte());
+    result |= static_cast<uint16_t>(static_cast<uint16_t>(get_byte()) << 8);
 
     return result;
 }
 
 uint16_t FileHolder::get16be() {
-    uint16_t result = static_cast<uint16_t>(static_cast<uint16_t>(std::fgetc(file_)) << 8);
-    result |= static_cast<uint16_t>(std::fgetc(file_));
+    uint16_t result = static_cast<uint16_t>(static_cast<uint16_t>(get_byte()) << 8);
+    result |= static_cast<uint16_t>(get_byte());
 
     return result;
 }
 
 uint8_t FileHolder::get8() {
-    return static_cast<uint8_t>(std::fgetc(file_));
+    return static_cast<uint8_t>(get_byte());
 }
 
 void FileHolder::put16be(uint16_t value) {
-	std::fputc(value >> 8, file_);
-	std::fputc(value, file_);
+	put8(static_cast<uint8_t>(value >> 8));
+	put8(static_cast<uint8_t>(value));
 }
 
 void FileHolder::put16le(uint16_t value) {
-	std::fputc(value, file_);
-	std::fputc(value >> 8, file_);
+	put8(static_cast<uint8_t>(value));
+	put8(static_cast<uint8_t>(value >> 8));
 }
 
 void FileHolder::put8(uint8_t value) {
+	if(!file_) return;
+	has_unflushed_writes_ = true;
 	std::fputc(value, file_);
 }
 
@@ -113,40 +181,63 @@ void FileHolder::putn(std::size_t repeats, uint8_t value) {
 
 std::vector<uint8_t> FileHolder::read(std::size_t size) {
 	std::vector<uint8_t> result(size);
-	result.resize(std::fread(result.data(), 1, size, file_));
+	result.resize(read(result.data(), size));
 	return result;
 }
 
 std::size_t FileHolder::read(uint8_t *buffer, std::size_t size) {
-    return std::fread(buffer, 1, size, file_);
+	if(file_) return std::fread(buffer, 1, size, file_);
+
+	const std::size_t available = (cursor_ < mapping_size_) ? std::min(size, mapping_size_ - cursor_) : 0;
+	if(available) std::memcpy(buffer, &mapping_[cursor_], available);
+	cursor_ += available;
+	if(available < size) is_at_end_ = true;
+	return available;
 }
 
 std::size_t FileHolder::write(const std::vector<uint8_t> &buffer) {
-	return std::fwrite(buffer.data(), 1, buffer.size(), file_);
+	return write(buffer.data(), buffer.size());
 }
 
 std::size_t FileHolder::write(const uint8_t *buffer, std::size_t size) {
-    return std::fwrite(buffer, 1, size, file_);
+	if(!file_) return 0;
+	has_unflushed_writes_ = true;
+	return std::fwrite(buffer, 1, size, file_);
 }
 
 void FileHolder::seek(long offset, int whence) {
-	std::fseek(file_, offset, whence);
+	if(file_) {
+		std::fseek(file_, offset, whence);
+		return;
+	}
+
+	long target = offset;
+	switch(whence) {
+		default:		break;
+		case SEEK_CUR:	target += static_cast<long>(cursor_);		break;
+		case SEEK_END:	target += static_cast<long>(mapping_size_);	break;
+	}
+	if(target < 0) return;
+	cursor_ = static_cast<std::size_t>(target);
+	is_at_end_ = false;
 }
 
 long FileHolder::tell() {
-	return std::ftell(file_);
+	if(file_) return std::ftell(file_);
+	return static_cast<long>(cursor_);
 }
 
 void FileHolder::flush() {
-	std::fflush(file_);
+	if(file_) std::fflush(file_);
 }
 
 bool FileHolder::eof() {
-	return std::feof(file_);
+	if(file_) return std::feof(file_);
+	return is_at_end_;
 }
 
 FileHolder::BitStream FileHolder::get_bitstream(bool lsb_first) {
-	return BitStream(file_, lsb_first);
+	return BitStream(*this, lsb_first);
 }
 
 bool FileHolder::check_signature(const char *signature, std::size_t length) {
@@ -170,6 +261,8 @@ std::string FileHolder::extension() {
 }
 
 void FileHolder::ensure_is_at_least_length(long length) {
+    if(!file_) return;
+    has_unflushed_writes_ = true;
     std::fseek(file_, 0, SEEK_END);
     long bytes_to_write = length - ftell(file_);
     if(bytes_to_write > 0) {
@@ -27,7 +27,8 @@ class FileHolder final {
 		enum class FileMode {
 			ReadWrite,
 			Read,
-			Rewrite
+			Rewrite,
+			MappedRead
 		};
 
 		~FileHolder();
@@ -41,6 +42,8 @@ class FileHolder final {
 				Read		attempts to open this file for reading only.
 				Rewrite		opens the file for rewriting; none of the original content is preserved; whatever
 							the caller outputs will replace the existing file.
+				MappedRead	maps the file into memory for reading only; all reads are then served from memory,
+							without the overhead of stdio, and views cost nothing. Writes are ignored.
 
 			@raises ErrorCantOpen if the file cannot be opened.
 		*/
@@ -125,6 +128,29 @@ class FileHolder final {
 		/*! @returns @c true if the end-of-file indicator is set, @c false otherwise. */
 		bool eof();
 
+		/*!
+			A read-only view of a range of bytes within a file. It remains valid until the file is next
+			written to or the @c FileHolder is destroyed.
+		*/
+		struct Span {
+			const uint8_t *data = nullptr;
+			std::size_t size = 0;
+
+			const uint8_t *begin() const	{	return data;		}
+			const uint8_t *end() const		{	return data + size;	}
+			bool empty() const				{	return !size;		}
+			uint8_t operator[](std::size_t index) const	{	return data[index];	}
+		};
+
+		/*!
+			Provides direct access to up to @c length bytes of the file, starting from @c offset, without copying them.
+			The view will be shorter than requested if the file ends first. The reading cursor is unaffected.
+
+			This is available in any mode but it is cheapest in MappedRead mode. In other modes the file is mapped
+			upon first request, and any writes are flushed before a view is taken.
+		*/
+		Span view(long offset, std::size_t length);
+
 		class BitStream {
 			public:
 				uint8_t get_bits(int q) {
@@ -136,14 +162,14 @@ class FileHolder final {
 				}
 
 			private:
-				BitStream(FILE *file, bool lsb_first) :
+				BitStream(FileHolder &file, bool lsb_first) :
 					file_(file),
 					lsb_first_(lsb_first),
 					next_value_(0),
 					bits_remaining_(0) {}
 				friend FileHolder;
 
-				FILE *file_;
+				FileHolder &file_;
 				bool lsb_first_;
 				uint8_t next_value_;
 				int bits_remaining_;
@@ -151,7 +177,7 @@ class FileHolder final {
 				uint8_t get_bit() {
 					if(!bits_remaining_) {
 						bits_remaining_ = 8;
-						next_value_ = static_cast<uint8_t>(fgetc(file_));
+						next_value_ = file_.get8();
 					}
 
 					uint8_t bit;
@@ -218,6 +244,28 @@ class FileHolder final {
 		bool is_read_only_ = false;
 
 		std::mutex file_access_mutex_;
+
+		// The file's contents, if mapped into memory. In MappedRead mode, the reading
+		// cursor and end-of-file indicator are tracked here rather than by stdio.
+		const uint8_t *mapping_ = nullptr;
+		std::size_t mapping_size_ = 0;
+		bool has_mapping_ = false;
+		bool mapping_is_shared_ = false;	// i.e. the mapping will reflect any subsequent writes, once flushed.
+		std::vector<uint8_t> contents_;		// Holds the file's contents if they couldn't be mapped directly.
+		std::size_t cursor_ = 0;
+		bool is_at_end_ = false;
+		bool has_unflushed_writes_ = false;
+
+		void map();
+		void unmap();
+
+		/// Reads a single byte, as per @c fgetc.
+		inline int get_byte() {
+			if(file_) return std::fgetc(file_);
+			if(cursor_ < mapping_size_) return mapping_[cursor_++];
+			is_at_end_ = true;
+			return EOF;
+		}
 };
 
 }
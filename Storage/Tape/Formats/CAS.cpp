@@ -84,6 +84,23 @@ void CAS::virtual_reset() {
 	distance_into_bit_ = 0;
 }
 
+std::unique_ptr<Tape::ResumeState> CAS::get_resume_state() {
+	State *const state = new State;
+	state->chunk_pointer = chunk_pointer_;
+	state->phase = phase_;
+	state->distance_into_phase = distance_into_phase_;
+	state->distance_into_bit = distance_into_bit_;
+	return std::unique_ptr<ResumeState>(state);
+}
+
+void CAS::set_resume_state(const ResumeState &state) {
+	const State &cas_state = static_cast<const State &>(state);
+	chunk_pointer_ = cas_state.chunk_pointer;
+	phase_ = cas_state.phase;
+	distance_into_phase_ = cas_state.distance_into_phase;
+	distance_into_bit_ = cas_state.distance_into_bit;
+}
+
 Tape::Pulse CAS::virtual_get_next_pulse() {
 	Pulse pulse;
 	pulse.length.clock_rate = 9600;
@@ -65,6 +65,15 @@ class CAS: public Tape {
 		} phase_ = Phase::Header;
 		std::size_t distance_into_phase_ = 0;
 		std::size_t distance_into_bit_ = 0;
+
+		struct State: public ResumeState {
+			std::size_t chunk_pointer;
+			Phase phase;
+			std::size_t distance_into_phase;
+			std::size_t distance_into_bit;
+		};
+		std::unique_ptr<ResumeState> get_resume_state();
+		void set_resume_state(const ResumeState &state);
 };
 
 }
@@ -8,13 +8,15 @@
 
 #include "CSW.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 using namespace Storage::Tape;
 
 CSW::CSW(const std::string &file_name) :
-	source_data_pointer_(0) {
-	Storage::FileHolder file(file_name);
+	file_(new Storage::FileHolder(file_name, FileHolder::FileMode::MappedRead)) {
+	Storage::FileHolder &file = *file_;
 	if(file.stats().st_size < 0x20) throw ErrorNotCSW;
 
 	// Check signature.
@@ -59,52 +61,152 @@ CSW::CSW(const std::string &file_name) :
 		file.seek(0x34 + extension_length, SEEK_SET);
 	}
 
-	// Grab all data remaining in the file.
-	std::vector<uint8_t> file_data;
-	std::size_t remaining_data = static_cast<std::size_t>(file.stats().st_size) - static_cast<std::size_t>(file.tell());
-	file_data.resize(remaining_data);
-	file.read(file_data.data(), remaining_data);
+	// Keep the file mapped and note where its data begins; decompression, if any, occurs
+	// only as pulses are requested.
+	const FileHolder::Span file_data = file.view(file.tell(), static_cast<std::size_t>(file.stats().st_size) - static_cast<std::size_t>(file.tell()));
+	source_ = file_data.data;
+	source_size_ = file_data.size;
 
-	if(compression_type_ == CompressionType::ZRLE) {
-		// The only clue given by CSW as to the output size in bytes is that there will be
-		// number_of_waves waves. Waves are usually one byte, but may be five. So this code
-		// is pessimistic.
-		source_data_.resize(static_cast<std::size_t>(number_of_waves) * 5);
-
-		// uncompress will tell how many compressed bytes there actually were, so use its
-		// modification of output_length to throw away all the memory that isn't actually
-		// needed.
-		uLongf output_length = static_cast<uLongf>(number_of_waves * 5);
-		uncompress(source_data_.data(), &output_length, file_data.data(), file_data.size());
-		source_data_.resize(static_cast<std::size_t>(output_length));
-	} else {
-		source_data_ = std::move(file_data);
-	}
+	// The only clue given by CSW as to the output size in bytes is that there will be
+	// number_of_waves waves. Waves are usually one byte, but may be five.
+	maximum_inflated_size_ = static_cast<std::size_t>(number_of_waves) * 5;
+	set_source();
+	if(compression_type_ == CompressionType::ZRLE) set_maximum_checkpoints(MaximumInflatedCheckpoints);
 
 	invert_pulse();
+	initial_type_ = pulse_.type;
 }
 
-CSW::CSW(const std::vector<uint8_t> &&data, CompressionType compression_type, bool initial_level, uint32_t sampling_rate) {
+CSW::CSW(std::vector<uint8_t> &&data, CompressionType compression_type, bool initial_level, uint32_t sampling_rate) :
+	compression_type_(compression_type),
+	source_data_(std::move(data)),
+	maximum_inflated_size_(std::numeric_limits<std::size_t>::max()) {
 	pulse_.length.clock_rate = sampling_rate;
 	pulse_.type = initial_level ? Pulse::High : Pulse::Low;
-	source_data_ = std::move(data);
+	initial_type_ = pulse_.type;
+
+	source_ = source_data_.data();
+	source_size_ = source_data_.size();
+	set_source();
+	if(compression_type_ == CompressionType::ZRLE) set_maximum_checkpoints(MaximumInflatedCheckpoints);
+}
+
+CSW::~CSW() {
+	if(inflater_is_active_) inflateEnd(&inflater_);
+}
+
+void CSW::set_source() {
+	data_pointer_ = 0;
+
+	if(compression_type_ == CompressionType::RLE) {
+		data_ = source_;
+		data_size_ = source_size_;
+		return;
+	}
+
+	// Prepare to inflate from the start of the compressed data.
+	if(!inflater_is_active_) {
+		inflater_ = z_stream();
+		inflater_is_active_ = inflateInit(&inflater_) == Z_OK;
+		inflated_.resize(InflationBufferSize);
+	} else {
+		inflateReset(&inflater_);
+	}
+	inflater_.next_in = const_cast<Bytef *>(source_);
+	inflater_.avail_in = static_cast<uInt>(source_size_);
+	inflater_is_finished_ = !inflater_is_active_;
+	total_inflated_size_ = 0;
+
+	data_ = inflated_.data();
+	data_size_ = 0;
+}
+
+bool CSW::ensure_available(std::size_t length) {
+	while(data_size_ - data_pointer_ < length && !inflater_is_finished_) {
+		// Move whatever hasn't yet been consumed to the front of the buffer, then refill the rest.
+		const std::size_t remainder = data_size_ - data_pointer_;
+		std::copy(inflated_.begin() + static_cast<long>(data_pointer_), inflated_.begin() + static_cast<long>(data_size_), inflated_.begin());
+		data_pointer_ = 0;
+		data_size_ = remainder;
+
+		const std::size_t capacity = std::min(inflated_.size() - remainder, maximum_inflated_size_ - total_inflated_size_);
+		inflater_.next_out = &inflated_[remainder];
+		inflater_.avail_out = static_cast<uInt>(capacity);
+
+		const int result = inflate(&inflater_, Z_NO_FLUSH);
+		const std::size_t produced = capacity - inflater_.avail_out;
+		data_size_ += produced;
+		total_inflated_size_ += produced;
+
+		// Stop at the end of the stream, upon any error, or once as many bytes have been
+		// produced as the file can legitimately contain.
+		if(
+			(result != Z_OK) ||
+			(total_inflated_size_ == maximum_inflated_size_) ||
+			(!produced && !inflater_.avail_in)
+		) {
+			inflater_is_finished_ = true;
+		}
+	}
+	return data_size_ - data_pointer_ >= length;
+}
+
+CSW::State::~State() {
+	if(inflater_is_active) inflateEnd(&inflater);
+}
+
+std::unique_ptr<Tape::ResumeState> CSW::get_resume_state() {
+	std::unique_ptr<State> state(new State);
+	state->type = pulse_.type;
+
+	if(compression_type_ == CompressionType::ZRLE) {
+		if(!inflater_is_active_ || total_inflated_size_ < next_inflated_checkpoint_) return nullptr;
+		next_inflated_checkpoint_ = total_inflated_size_ + MinimumInflatedCheckpointDistance;
+
+		// Keep only those inflated bytes that are yet to be consumed.
+		state->inflater_is_active = inflateCopy(&state->inflater, &inflater_) == Z_OK;
+		if(!state->inflater_is_active) return nullptr;
+		state->inflater_is_finished = inflater_is_finished_;
+		state->total_inflated_size = total_inflated_size_;
+		state->inflated.assign(inflated_.begin() + static_cast<long>(data_pointer_), inflated_.begin() + static_cast<long>(data_size_));
+		state->data_pointer = 0;
+	} else {
+		state->data_pointer = data_pointer_;
+	}
+
+	return std::move(state);
+}
+
+void CSW::set_resume_state(const ResumeState &state) {
+	const State &csw_state = static_cast<const State &>(state);
+	pulse_.type = csw_state.type;
+	data_pointer_ = csw_state.data_pointer;
+
+	if(compression_type_ == CompressionType::ZRLE) {
+		inflateEnd(&inflater_);
+		inflater_is_active_ = inflateCopy(&inflater_, const_cast<z_stream *>(&csw_state.inflater)) == Z_OK;
+		inflater_is_finished_ = csw_state.inflater_is_finished || !inflater_is_active_;
+		total_inflated_size_ = csw_state.total_inflated_size;
+		std::copy(csw_state.inflated.begin(), csw_state.inflated.end(), inflated_.begin());
+		data_size_ = csw_state.inflated.size();
+	}
 }
 
 uint8_t CSW::get_next_byte() {
-	if(source_data_pointer_ == source_data_.size()) return 0xff;
-	uint8_t result = source_data_[source_data_pointer_];
-	source_data_pointer_++;
+	if(!ensure_available(1)) return 0xff;
+	uint8_t result = data_[data_pointer_];
+	data_pointer_++;
 	return result;
 }
 
 uint32_t CSW::get_next_int32le() {
-	if(source_data_pointer_ > source_data_.size() - 4) return 0xffff;
+	if(!ensure_available(4)) return 0xffff;
 	uint32_t result = (uint32_t)(
-		(source_data_[source_data_pointer_ + 0] << 0) |
-		(source_data_[source_data_pointer_ + 1] << 8) |
-		(source_data_[source_data_pointer_ + 2] << 16) |
-		(source_data_[source_data_pointer_ + 3] << 24));
-	source_data_pointer_ += 4;
+		(data_[data_pointer_ + 0] << 0) |
+		(data_[data_pointer_ + 1] << 8) |
+		(data_[data_pointer_ + 2] << 16) |
+		(data_[data_pointer_ + 3] << 24));
+	data_pointer_ += 4;
 	return result;
 }
 
@@ -113,11 +215,12 @@ void CSW::invert_pulse() {
 }
 
 bool CSW::is_at_end() {
-	return source_data_pointer_ == source_data_.size();
+	return !ensure_available(1);
 }
 
 void CSW::virtual_reset() {
-	source_data_pointer_ = 0;
+	pulse_.type = initial_type_;
+	set_source();
 }
 
 Tape::Pulse CSW::virtual_get_next_pulse() {
@@ -12,6 +12,7 @@
 #include "../Tape.hpp"
 #include "../../FileHolder.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <zlib.h>
@@ -39,7 +40,10 @@ class CSW: public Tape {
 		/*!
 			Constructs a @c CSW containing content as specified. Does not throw.
 		*/
-		CSW(const std::vector<uint8_t> &&data, CompressionType compression_type, bool initial_level, uint32_t sampling_rate);
+		CSW(std::vector<uint8_t> &&data, CompressionType compression_type, bool initial_level, uint32_t sampling_rate);
+
+		~CSW();
+		CSW(const CSW &) = delete;
 
 		enum {
 			ErrorNotCSW
@@ -53,14 +57,59 @@ class CSW: public Tape {
 		Pulse virtual_get_next_pulse();
 
 		Pulse pulse_;
+		Pulse::Type initial_type_;
 		CompressionType compression_type_;
 
 		uint8_t get_next_byte();
 		uint32_t get_next_int32le();
 		void invert_pulse();
 
+		// The tape's data as stored, which is compressed if this is a ZRLE CSW; it is held either
+		// by file_, which keeps it mapped, or by source_data_.
+		std::unique_ptr<Storage::FileHolder> file_;
 		std::vector<uint8_t> source_data_;
-		std::size_t source_data_pointer_;
+		const uint8_t *source_ = nullptr;
+		std::size_t source_size_ = 0;
+
+		// RLE data is read directly from source_; ZRLE data is inflated from there into inflated_
+		// only as it is needed, so that memory usage is bounded regardless of tape length.
+		// data_ points to whichever is in use.
+		const uint8_t *data_ = nullptr;
+		std::size_t data_size_ = 0;
+		std::size_t data_pointer_ = 0;
+
+		static constexpr std::size_t InflationBufferSize = 16384;
+		z_stream inflater_;
+		bool inflater_is_active_ = false;
+		bool inflater_is_finished_ = false;
+		std::size_t maximum_inflated_size_;
+		std::size_t total_inflated_size_ = 0;
+		std::vector<uint8_t> inflated_;
+
+		void set_source();
+		bool ensure_available(std::size_t length);
+
+		// Checkpoints of RLE data need record only a position; those of ZRLE data capture the
+		// whole inflater, including its window, so are permitted only once per
+		// MinimumInflatedCheckpointDistance bytes of output, and no more than
+		// MaximumInflatedCheckpoints are kept.
+		static constexpr std::size_t MinimumInflatedCheckpointDistance = 256*1024;
+		static constexpr std::size_t MaximumInflatedCheckpoints = 64;
+		std::size_t next_inflated_checkpoint_ = 0;
+		struct State: public ResumeState {
+			Pulse::Type type;
+			std::size_t data_pointer;
+
+			z_stream inflater;
+			bool inflater_is_active = false;
+			bool inflater_is_finished;
+			std::size_t total_inflated_size;
+			std::vector<uint8_t> inflated;
+
+			~State();
+		};
+		std::unique_ptr<ResumeState> get_resume_state();
+		void set_resume_state(const ResumeState &state);
 };
 
 }
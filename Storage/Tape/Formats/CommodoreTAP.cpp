@@ -47,6 +47,23 @@ void CommodoreTAP::virtual_reset()
 	is_at_end_ = false;
 }
 
+std::unique_ptr<Storage::Tape::Tape::ResumeState> CommodoreTAP::get_resume_state()
+{
+	State *const state = new State;
+	state->file_offset = file_.tell();
+	state->current_pulse = current_pulse_;
+	state->is_at_end = is_at_end_;
+	return std::unique_ptr<ResumeState>(state);
+}
+
+void CommodoreTAP::set_resume_state(const ResumeState &state)
+{
+	const State &tap_state = static_cast<const State &>(state);
+	file_.seek(tap_state.file_offset, SEEK_SET);
+	current_pulse_ = tap_state.current_pulse;
+	is_at_end_ = tap_state.is_at_end;
+}
+
 bool CommodoreTAP::is_at_end()
 {
 	return is_at_end_;
@@ -47,6 +47,14 @@ class CommodoreTAP: public Tape {
 
 		Pulse current_pulse_;
 		bool is_at_end_ = false;
+
+		struct State: public ResumeState {
+			long file_offset;
+			Pulse current_pulse;
+			bool is_at_end;
+		};
+		std::unique_ptr<ResumeState> get_resume_state();
+		void set_resume_state(const ResumeState &state);
 };
 
 }
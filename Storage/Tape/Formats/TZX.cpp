@@ -18,7 +18,7 @@ const unsigned int TZXClockMSMultiplier = 3500;
 }
 
 TZX::TZX(const std::string &file_name) :
-	file_(file_name),
+	file_(file_name, FileHolder::FileMode::MappedRead),
 	current_level_(false) {
 
 	// Check for signature followed by a 0x1a
@@ -47,6 +47,19 @@ void TZX::virtual_reset() {
 	post_gap(500);
 }
 
+std::unique_ptr<Tape::ResumeState> TZX::get_batch_resume_state() {
+	State *const state = new State;
+	state->file_offset = file_.tell();
+	state->current_level = current_level_;
+	return std::unique_ptr<ResumeState>(state);
+}
+
+void TZX::set_batch_resume_state(const ResumeState &state) {
+	const State &tzx_state = static_cast<const State &>(state);
+	file_.seek(tzx_state.file_offset, SEEK_SET);
+	current_level_ = tzx_state.current_level;
+}
+
 void TZX::get_next_pulses() {
 	while(empty()) {
 		uint8_t chunk_id = file_.get8();
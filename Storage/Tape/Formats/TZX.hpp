@@ -41,6 +41,13 @@ class TZX: public PulseQueuedTape {
 
 		bool current_level_;
 
+		struct State: public ResumeState {
+			long file_offset;
+			bool current_level;
+		};
+		std::unique_ptr<ResumeState> get_batch_resume_state();
+		void set_batch_resume_state(const ResumeState &state);
+
 		void get_standard_speed_data_block();
 		void get_turbo_speed_data_block();
 		void get_pure_tone_data_block();
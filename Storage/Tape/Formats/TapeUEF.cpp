@@ -7,106 +7,260 @@
 //
 
 #include "TapeUEF.hpp"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
 
-// MARK: - ZLib extensions
+using namespace Storage::Tape;
 
-static float gzgetfloat(gzFile file) {
-	uint8_t bytes[4];
-	gzread(file, bytes, 4);
+UEF::UEF(const std::string &file_name) {
+	try {
+		file_.reset(new Storage::FileHolder(file_name, FileHolder::FileMode::MappedRead));
+	} catch(...) {
+		throw ErrorNotUEF;
+	}
 
-	/* assume a four byte array named Float exists, where Float[0]
-	was the first byte read from the UEF, Float[1] the second, etc */
+	// Keep the file mapped; it'll be inflated, if necessary, only as it is read.
+	const FileHolder::Span file_data = file_->view(0, static_cast<std::size_t>(file_->stats().st_size));
+	source_ = file_data.data;
+	source_size_ = file_data.size;
+	is_compressed_ = source_size_ >= 2 && source_[0] == 0x1f && source_[1] == 0x8b;
+	if(is_compressed_) set_maximum_checkpoints(MaximumInflatedCheckpoints);
+	rewind();
 
-	/* decode mantissa */
-	int mantissa;
-	mantissa = bytes[0] | (bytes[1] << 8) | ((bytes[2]&0x7f)|0x80) << 16;
+	char identifier[10];
+	read(reinterpret_cast<uint8_t *>(identifier), 10);
+	if(did_overrun_ || std::strcmp(identifier, "UEF File!")) {
+		throw ErrorNotUEF;
+	}
 
-	float result = static_cast<float>(mantissa);
-	result = static_cast<float>(ldexp(result, -23));
+	uint8_t version[2];
+	read(version, 2);
 
-	/* decode exponent */
-	int exponent;
-	exponent = ((bytes[2]&0x80) >> 7) | (bytes[3]&0x7f) << 1;
-	exponent -= 127;
-	result = static_cast<float>(ldexp(result, exponent));
+	if(version[1] > 0 || version[0] > 10) {
+		throw ErrorNotUEF;
+	}
 
-	/* flip sign if necessary */
-	if(bytes[3]&0x80)
-		result = -result;
+	set_platform_type();
+}
 
-	return result;
+UEF::~UEF() {
+	if(inflater_is_active_) inflateEnd(&inflater_);
+}
+
+// MARK: - File access
+
+void UEF::rewind() {
+	data_pointer_ = 0;
+	data_position_ = 0;
+	did_overrun_ = false;
+
+	if(!is_compressed_) {
+		data_ = source_;
+		data_size_ = source_size_;
+		return;
+	}
+
+	// Prepare to inflate from the start of the file.
+	if(!inflater_is_active_) {
+		inflater_ = z_stream();
+		inflater_is_active_ = inflateInit2(&inflater_, 16 + MAX_WBITS) == Z_OK;
+		inflated_.resize(InflationBufferSize);
+	} else {
+		inflateReset(&inflater_);
+	}
+	inflater_.next_in = const_cast<Bytef *>(source_);
+	inflater_.avail_in = static_cast<uInt>(source_size_);
+	inflater_is_finished_ = !inflater_is_active_;
+	inflater_state_.reset();
+
+	data_ = inflated_.data();
+	data_size_ = 0;
+}
+
+bool UEF::ensure_available(std::size_t length) {
+	while(data_size_ - data_pointer_ < length && is_compressed_ && !inflater_is_finished_) {
+		// Move whatever hasn't yet been consumed to the front of the buffer, then refill the rest.
+		const std::size_t remainder = data_size_ - data_pointer_;
+		std::copy(inflated_.begin() + static_cast<long>(data_pointer_), inflated_.begin() + static_cast<long>(data_size_), inflated_.begin());
+		data_position_ += data_pointer_;
+		data_pointer_ = 0;
+		data_size_ = remainder;
+
+		const std::size_t capacity = inflated_.size() - remainder;
+		inflater_.next_out = &inflated_[remainder];
+		inflater_.avail_out = static_cast<uInt>(capacity);
+
+		const int result = inflate(&inflater_, Z_NO_FLUSH);
+		const std::size_t produced = capacity - inflater_.avail_out;
+		data_size_ += produced;
+
+		// Stop at the end of the stream or upon any error.
+		if(result != Z_OK || (!produced && !inflater_.avail_in)) {
+			inflater_is_finished_ = true;
+		}
+	}
+	return data_size_ - data_pointer_ >= length;
+}
+
+void UEF::read(uint8_t *target, std::size_t length) {
+	if(ensure_available(length)) {
+		std::memcpy(target, &data_[data_pointer_], length);
+		data_pointer_ += length;
+		return;
+	}
+
+	// Supply whatever remains, and zeroes thereafter.
+	const std::size_t available = data_size_ - data_pointer_;
+	std::memcpy(target, &data_[data_pointer_], available);
+	std::memset(&target[available], 0, length - available);
+	data_pointer_ = data_size_;
+	did_overrun_ = true;
+}
+
+uint64_t UEF::get_file_offset() {
+	return data_position_ + data_pointer_;
 }
 
-static uint8_t gzget8(gzFile file) {
-	// This is a workaround for gzgetc, which seems to be broken in ZLib 1.2.8.
+void UEF::set_file_offset(uint64_t position) {
+	did_overrun_ = false;
+	if(position < data_position_) rewind();
+
+	while(true) {
+		if(position <= data_position_ + data_size_) {
+			data_pointer_ = static_cast<std::size_t>(position - data_position_);
+			return;
+		}
+
+		// Discard everything buffered and get more; a seek beyond the end of the file leaves it at the end.
+		data_pointer_ = data_size_;
+		if(!ensure_available(1)) return;
+	}
+}
+
+uint8_t UEF::get8() {
 	uint8_t result;
-	gzread(file, &result, 1);
+	read(&result, 1);
 	return result;
 }
 
-static int gzget16(gzFile file) {
+int UEF::get16() {
 	uint8_t bytes[2];
-	gzread(file, bytes, 2);
+	read(bytes, 2);
 	return bytes[0] | (bytes[1] << 8);
 }
 
-static int gzget24(gzFile file) {
+int UEF::get24() {
 	uint8_t bytes[3];
-	gzread(file, bytes, 3);
+	read(bytes, 3);
 	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16);
 }
 
-static int gzget32(gzFile file) {
+int UEF::get32() {
 	uint8_t bytes[4];
-	gzread(file, bytes, 4);
+	read(bytes, 4);
 	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (bytes[3] << 24);
 }
 
-using namespace Storage::Tape;
+float UEF::get_float() {
+	uint8_t bytes[4];
+	read(bytes, 4);
 
-UEF::UEF(const std::string &file_name) {
-	file_ = gzopen(file_name.c_str(), "rb");
+	/* assume a four byte array named Float exists, where Float[0]
+	was the first byte read from the UEF, Float[1] the second, etc */
 
-	char identifier[10];
-	int bytes_read = gzread(file_, identifier, 10);
-	if(bytes_read < 10 || std::strcmp(identifier, "UEF File!")) {
-		throw ErrorNotUEF;
-	}
+	/* decode mantissa */
+	int mantissa;
+	mantissa = bytes[0] | (bytes[1] << 8) | ((bytes[2]&0x7f)|0x80) << 16;
 
-	uint8_t version[2];
-	gzread(file_, version, 2);
+	float result = static_cast<float>(mantissa);
+	result = static_cast<float>(ldexp(result, -23));
 
-	if(version[1] > 0 || version[0] > 10) {
-		throw ErrorNotUEF;
-	}
+	/* decode exponent */
+	int exponent;
+	exponent = ((bytes[2]&0x80) >> 7) | (bytes[3]&0x7f) << 1;
+	exponent -= 127;
+	result = static_cast<float>(ldexp(result, exponent));
 
-	set_platform_type();
-}
+	/* flip sign if necessary */
+	if(bytes[3]&0x80)
+		result = -result;
 
-UEF::~UEF() {
-	gzclose(file_);
+	return result;
 }
 
 // MARK: - Public methods
 
 void UEF::virtual_reset() {
-	gzseek(file_, 12, SEEK_SET);
+	set_file_offset(12);
 	set_is_at_end(false);
 	clear();
+	time_base_ = 1200;
+	is_300_baud_ = false;
+}
+
+UEF::InflaterState::~InflaterState() {
+	inflateEnd(&inflater);
+}
+
+std::unique_ptr<Tape::ResumeState> UEF::get_batch_resume_state() {
+	State *const state = new State;
+	state->file_offset = get_file_offset();
+	state->time_base = time_base_;
+	state->is_300_baud = is_300_baud_;
+
+	// Copy the inflater if it has moved sufficiently far beyond the previous copy.
+	if(is_compressed_ && inflater_is_active_) {
+		const uint64_t previous_position = inflater_state_ ? inflater_state_->position : 0;
+		if(state->file_offset - previous_position >= MinimumInflaterStateDistance) {
+			std::shared_ptr<InflaterState> inflater_state(new InflaterState);
+			if(inflateCopy(&inflater_state->inflater, &inflater_) == Z_OK) {
+				inflater_state->is_finished = inflater_is_finished_;
+				inflater_state->position = state->file_offset;
+				inflater_state->unconsumed.assign(inflated_.begin() + static_cast<long>(data_pointer_), inflated_.begin() + static_cast<long>(data_size_));
+				inflater_state_ = inflater_state;
+			} else {
+				// The destructor will call inflateEnd; make sure that's harmless.
+				inflater_state->inflater = z_stream();
+			}
+		}
+	}
+	state->inflater_state = inflater_state_;
+
+	return std::unique_ptr<ResumeState>(state);
+}
+
+void UEF::set_batch_resume_state(const ResumeState &state) {
+	const State &uef_state = static_cast<const State &>(state);
+
+	// Resume inflation from the most recent copy of the inflater, if there is one.
+	const std::shared_ptr<InflaterState> &inflater_state = uef_state.inflater_state;
+	if(inflater_state) {
+		inflateEnd(&inflater_);
+		inflater_is_active_ = inflateCopy(&inflater_, &inflater_state->inflater) == Z_OK;
+		inflater_is_finished_ = inflater_state->is_finished || !inflater_is_active_;
+		std::copy(inflater_state->unconsumed.begin(), inflater_state->unconsumed.end(), inflated_.begin());
+		data_size_ = inflater_state->unconsumed.size();
+		data_pointer_ = 0;
+		data_position_ = inflater_state->position;
+		inflater_state_ = inflater_state;
+	}
+
+	set_file_offset(uef_state.file_offset);
+	time_base_ = uef_state.time_base;
+	is_300_baud_ = uef_state.is_300_baud;
 }
 
 // MARK: - Chunk navigator
 
 bool UEF::get_next_chunk(UEF::Chunk &result) {
-	uint16_t chunk_id = static_cast<uint16_t>(gzget16(file_));
-	uint32_t chunk_length = (uint32_t)gzget32(file_);
-	z_off_t start_of_next_chunk = gztell(file_) + chunk_length;
+	uint16_t chunk_id = static_cast<uint16_t>(get16());
+	uint32_t chunk_length = (uint32_t)get32();
+	uint64_t start_of_next_chunk = get_file_offset() + chunk_length;
 
-	if(gzeof(file_)) {
+	if(did_overrun_) {
 		return false;
 	}
 
@@ -141,13 +295,13 @@ void UEF::get_next_pulses() {
 			// change of base rate
 			case 0x0113: {
 				// TODO: something smarter than just converting this to an int
-				float new_time_base = gzgetfloat(file_);
+				float new_time_base = get_float();
 				time_base_ = static_cast<unsigned int>(roundf(new_time_base));
 			}
 			break;
 
 			case 0x0117: {
-				int baud_rate = gzget16(file_);
+				int baud_rate = get16();
 				is_300_baud_ = (baud_rate == 300);
 			}
 			break;
@@ -157,7 +311,7 @@ void UEF::get_next_pulses() {
 			break;
 		}
 
-		gzseek(file_, next_chunk.start_of_next_chunk, SEEK_SET);
+		set_file_offset(next_chunk.start_of_next_chunk);
 	}
 }
 
@@ -165,15 +319,15 @@ void UEF::get_next_pulses() {
 
 void UEF::queue_implicit_bit_pattern(uint32_t length) {
 	while(length--) {
-		queue_implicit_byte(gzget8(file_));
+		queue_implicit_byte(get8());
 	}
 }
 
 void UEF::queue_explicit_bit_pattern(uint32_t length) {
-	std::size_t length_in_bits = (length << 3) - static_cast<std::size_t>(gzget8(file_));
+	std::size_t length_in_bits = (length << 3) - static_cast<std::size_t>(get8());
 	uint8_t current_byte = 0;
 	for(std::size_t bit = 0; bit < length_in_bits; bit++) {
-		if(!(bit&7)) current_byte = gzget8(file_);
+		if(!(bit&7)) current_byte = get8();
 		queue_bit(current_byte&1);
 		current_byte >>= 1;
 	}
@@ -181,13 +335,13 @@ void UEF::queue_explicit_bit_pattern(uint32_t length) {
 
 void UEF::queue_integer_gap() {
 	Time duration;
-	duration.length = static_cast<unsigned int>(gzget16(file_));
+	duration.length = static_cast<unsigned int>(get16());
 	duration.clock_rate = time_base_;
 	emplace_back(Pulse::Zero, duration);
 }
 
 void UEF::queue_floating_point_gap() {
-	float length = gzgetfloat(file_);
+	float length = get_float();
 	Time duration;
 	duration.length = static_cast<unsigned int>(length * 4000000);
 	duration.clock_rate = 4000000;
@@ -195,26 +349,26 @@ void UEF::queue_floating_point_gap() {
 }
 
 void UEF::queue_carrier_tone() {
-	unsigned int number_of_cycles = static_cast<unsigned int>(gzget16(file_));
+	unsigned int number_of_cycles = static_cast<unsigned int>(get16());
 	while(number_of_cycles--) queue_bit(1);
 }
 
 void UEF::queue_carrier_tone_with_dummy() {
-	unsigned int pre_cycles = static_cast<unsigned int>(gzget16(file_));
-	unsigned int post_cycles = static_cast<unsigned int>(gzget16(file_));
+	unsigned int pre_cycles = static_cast<unsigned int>(get16());
+	unsigned int post_cycles = static_cast<unsigned int>(get16());
 	while(pre_cycles--) queue_bit(1);
 	queue_implicit_byte(0xaa);
 	while(post_cycles--) queue_bit(1);
 }
 
 void UEF::queue_security_cycles() {
-	int number_of_cycles = gzget24(file_);
-	bool first_is_pulse = gzget8(file_) == 'P';
-	bool last_is_pulse = gzget8(file_) == 'P';
+	int number_of_cycles = get24();
+	bool first_is_pulse = get8() == 'P';
+	bool last_is_pulse = get8() == 'P';
 
 	uint8_t current_byte = 0;
 	for(int cycle = 0; cycle < number_of_cycles; cycle++) {
-		if(!(cycle&7)) current_byte = gzget8(file_);
+		if(!(cycle&7)) current_byte = get8();
 		int bit = (current_byte >> 7);
 		current_byte <<= 1;
 
@@ -236,16 +390,16 @@ void UEF::queue_security_cycles() {
 void UEF::queue_defined_data(uint32_t length) {
 	if(length < 3) return;
 
-	int bits_per_packet = gzget8(file_);
-	char parity_type = (char)gzget8(file_);
-	int number_of_stop_bits = gzget8(file_);
+	int bits_per_packet = get8();
+	char parity_type = (char)get8();
+	int number_of_stop_bits = get8();
 
 	bool has_extra_stop_wave = (number_of_stop_bits < 0);
 	number_of_stop_bits = abs(number_of_stop_bits);
 
 	length -= 3;
 	while(length--) {
-		uint8_t byte = gzget8(file_);
+		uint8_t byte = get8();
 
 		uint8_t parity_value = byte;
 		parity_value ^= (parity_value >> 4);
@@ -324,7 +478,7 @@ void UEF::set_platform_type() {
 	Chunk next_chunk;
 	while(get_next_chunk(next_chunk)) {
 		if(next_chunk.id == 0x0005) {
-			uint8_t target = gzget8(file_);
+			uint8_t target = get8();
 			switch(target >> 4) {
 				case 0:	platform_type_ = TargetPlatform::BBCModelA;		break;
 				case 1:	platform_type_ = TargetPlatform::AcornElectron;	break;
@@ -334,7 +488,7 @@ void UEF::set_platform_type() {
 				default: break;
 			}
 		}
-		gzseek(file_, next_chunk.start_of_next_chunk, SEEK_SET);
+		set_file_offset(next_chunk.start_of_next_chunk);
 	}
 	reset();
 }
@@ -11,10 +11,13 @@
 
 #include "../PulseQueuedTape.hpp"
 
+#include "../../FileHolder.hpp"
 #include "../../TargetPlatforms.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include <zlib.h>
 
 namespace Storage {
@@ -32,6 +35,7 @@ class UEF : public PulseQueuedTape, public TargetPlatform::TypeDistinguisher {
 		*/
 		UEF(const std::string &file_name);
 		~UEF();
+		UEF(const UEF &) = delete;
 
 		enum {
 			ErrorNotUEF
@@ -44,19 +48,76 @@ class UEF : public PulseQueuedTape, public TargetPlatform::TypeDistinguisher {
 		TargetPlatform::Type target_platform_type();
 		TargetPlatform::Type platform_type_ = TargetPlatform::Acorn;
 
-		gzFile file_;
 		unsigned int time_base_ = 1200;
 		bool is_300_baud_ = false;
 
+		// The file as stored, which is usually gzip-compressed; it is kept mapped by file_.
+		std::unique_ptr<Storage::FileHolder> file_;
+		const uint8_t *source_ = nullptr;
+		std::size_t source_size_ = 0;
+		bool is_compressed_ = false;
+
+		// Uncompressed files are read directly from source_; compressed files are inflated from there
+		// into inflated_ only as needed. data_ points to whichever is in use, and holds the file's contents
+		// from position data_position_. did_overrun_ is set if a read went beyond the end of the file.
+		const uint8_t *data_ = nullptr;
+		std::size_t data_size_ = 0;
+		std::size_t data_pointer_ = 0;
+		uint64_t data_position_ = 0;
+		bool did_overrun_ = false;
+
+		static constexpr std::size_t InflationBufferSize = 16384;
+		z_stream inflater_;
+		bool inflater_is_active_ = false;
+		bool inflater_is_finished_ = false;
+		std::vector<uint8_t> inflated_;
+
+		void rewind();
+		bool ensure_available(std::size_t length);
+		void read(uint8_t *target, std::size_t length);
+		uint64_t get_file_offset();
+		void set_file_offset(uint64_t position);
+
+		uint8_t get8();
+		int get16();
+		int get24();
+		int get32();
+		float get_float();
+
 		struct Chunk {
 			uint16_t id;
 			uint32_t length;
-			z_off_t start_of_next_chunk;
+			uint64_t start_of_next_chunk;
 		};
 
 		bool get_next_chunk(Chunk &);
 		void get_next_pulses();
 
+		// Checkpoints record a position within the file's contents. For compressed files each also refers to
+		// the most recent copy of the inflater, including its window, so that restoring it need inflate only
+		// from there. Copies are taken at most once per MinimumInflaterStateDistance bytes of output and are
+		// shared by all checkpoints between them; no more than MaximumInflatedCheckpoints checkpoints are kept.
+		static constexpr uint64_t MinimumInflaterStateDistance = 64*1024;
+		static constexpr std::size_t MaximumInflatedCheckpoints = 256;
+		struct InflaterState {
+			z_stream inflater;
+			bool is_finished;
+			uint64_t position;
+			std::vector<uint8_t> unconsumed;
+
+			~InflaterState();
+		};
+		std::shared_ptr<InflaterState> inflater_state_;
+
+		struct State: public ResumeState {
+			uint64_t file_offset;
+			unsigned int time_base;
+			bool is_300_baud;
+			std::shared_ptr<InflaterState> inflater_state;
+		};
+		std::unique_ptr<ResumeState> get_batch_resume_state();
+		void set_batch_resume_state(const ResumeState &state);
+
 		void queue_implicit_bit_pattern(uint32_t length);
 		void queue_explicit_bit_pattern(uint32_t length);
 
@@ -84,6 +84,11 @@ void Shifter::process_pulse(const Storage::Tape::Tape::Pulse &pulse) {
 	was_high_ = is_high;
 }
 
+void Shifter::serialise(State::Archive &archive) {
+	pll_.serialise(archive);
+	archive(was_high_, input_pattern_, input_bit_counter_);
+}
+
 void Shifter::digital_phase_locked_loop_output_bit(int value) {
 	input_pattern_ = ((input_pattern_ << 1) | static_cast<unsigned int>(value)) & 0xf;
 	switch(input_pattern_) {
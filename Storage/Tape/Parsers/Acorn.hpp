@@ -33,6 +33,9 @@ class Shifter: public Storage::DigitalPhaseLockedLoop::Delegate {
 
 		void digital_phase_locked_loop_output_bit(int value);
 
+		/// Records or restores the PLL and the partially-assembled input pattern.
+		void serialise(State::Archive &archive);
+
 	private:
 		Storage::DigitalPhaseLockedLoop pll_;
 		bool was_high_;
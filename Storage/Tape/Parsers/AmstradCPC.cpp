@@ -0,0 +1,113 @@
+//
+//  AmstradCPC.cpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#include "AmstradCPC.hpp"
+
+#include "../../../NumberTheory/CRC.hpp"
+
+using namespace Storage::Tape::AmstradCPC;
+
+namespace {
+
+/// The minimum number of consistent half-cycles that will be accepted as a leader.
+const int MinimumLeaderLength = 512;
+
+/*!
+	Runs @c tape_player until the tape input next changes level.
+
+	@returns the time taken, in seconds.
+*/
+float next_half_cycle(Storage::Tape::BinaryTapePlayer &tape_player) {
+	const bool level = tape_player.get_input();
+	float length = 0.0f;
+	while(level == tape_player.get_input() && !tape_player.get_tape()->is_at_end()) {
+		length += static_cast<float>(tape_player.get_cycles_until_next_event()) / static_cast<float>(tape_player.get_input_clock_rate());
+		tape_player.run_for_input_pulse();
+	}
+	return length;
+}
+
+/*!
+	Reads a byte from @c tape_player, most significant bit first. Each bit is a complete cycle,
+	that of a '1' being twice as long as that of a '0'.
+
+	@param threshold The cycle length, in seconds, at or above which a bit is a '1'.
+*/
+uint8_t get_byte(float threshold, Storage::Tape::BinaryTapePlayer &tape_player) {
+	uint8_t result = 0;
+	for(int bit = 0; bit < 8; ++bit) {
+		const float cycle_length = next_half_cycle(tape_player) + next_half_cycle(tape_player);
+		result = static_cast<uint8_t>((result << 1) | ((cycle_length >= threshold) ? 1 : 0));
+	}
+	return result;
+}
+
+}
+
+std::unique_ptr<std::vector<uint8_t>> Parser::read_record(uint8_t sync, std::size_t length, Storage::Tape::BinaryTapePlayer &tape_player) {
+	if(!tape_player.get_motor_control()) {
+		return nullptr;
+	}
+
+	while(!tape_player.get_tape()->is_at_end()) {
+		// Find a leader: a run of half-cycles of consistent length, ended by a noticeably
+		// shorter one, which is the first half of the '0' bit that precedes the sync byte.
+		float leader_total = 0.0f;
+		int leader_length = 0;
+		float half_cycle = 0.0f;
+		while(!tape_player.get_tape()->is_at_end()) {
+			half_cycle = next_half_cycle(tape_player);
+			if(leader_length) {
+				const float average = leader_total / static_cast<float>(leader_length);
+				if(half_cycle < average * 0.75f) {
+					if(leader_length >= MinimumLeaderLength) break;
+					leader_total = 0.0f;
+					leader_length = 0;
+				} else if(half_cycle > average * 1.25f) {
+					leader_total = 0.0f;
+					leader_length = 0;
+				}
+			}
+			leader_total += half_cycle;
+			++leader_length;
+		}
+		if(tape_player.get_tape()->is_at_end()) break;
+
+		// The leader is composed of '1's, so a '0' is half the length of one of its cycles;
+		// set the threshold between the two. Then check that this really was a '0'.
+		const float threshold = 1.5f * leader_total / static_cast<float>(leader_length);
+		if(half_cycle + next_half_cycle(tape_player) >= threshold) continue;
+
+		// Skip any record that isn't the one sought.
+		if(get_byte(threshold, tape_player) != sync) continue;
+
+		// Read segments, each 256 bytes and a CRC, until the required number of bytes has been obtained.
+		std::unique_ptr<std::vector<uint8_t>> result(new std::vector<uint8_t>);
+		result->reserve(length);
+		NumberTheory::CRC16 crc_generator(0x1021, 0xffff);
+		while(result->size() < length) {
+			crc_generator.reset();
+			for(int c = 0; c < 256; ++c) {
+				const uint8_t next = get_byte(threshold, tape_player);
+				crc_generator.add(next);
+				if(result->size() < length) result->push_back(next);
+			}
+
+			// The CRC is stored inverted, high byte first.
+			uint16_t crc = static_cast<uint16_t>(get_byte(threshold, tape_player) << 8);
+			crc |= get_byte(threshold, tape_player);
+			if(tape_player.get_tape()->is_at_end() || crc != static_cast<uint16_t>(~crc_generator.get_value())) {
+				return nullptr;
+			}
+		}
+
+		return result;
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,47 @@
+//
+//  AmstradCPC.hpp
+//  Clock Signal
+//
+//  Created by agent on 17/10/2026.
+//  Copyright 2026 agent. All rights reserved.
+//
+
+#ifndef Storage_Tape_Parsers_AmstradCPC_hpp
+#define Storage_Tape_Parsers_AmstradCPC_hpp
+
+#include "../Tape.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Storage {
+namespace Tape {
+namespace AmstradCPC {
+
+class Parser {
+	public:
+		/*!
+			Reads the next record with sync byte @c sync from the tape, skipping any others.
+
+			Attempts to duplicate the CPC firmware's CAS READ: a record is a leader of '1' bits,
+			from which the speed of the record is determined, then a '0' bit, the sync byte, and
+			the record's content as 256-byte segments that are each followed by a CRC.
+
+			@param sync The sync byte of the record sought; the firmware uses 0x2c for headers
+				and 0x16 for data.
+			@param length The number of bytes sought; these will be the first @c length bytes
+				of the record, which will otherwise be read to the end of the segment containing
+				its final byte.
+			@param tape_player The tape player containing the tape to read from.
+			@returns The @c length bytes read if a matching record was found before the end of
+				the tape and all of its segments passed CRC checks; @c nullptr otherwise.
+		*/
+		static std::unique_ptr<std::vector<uint8_t>> read_record(uint8_t sync, std::size_t length, Storage::Tape::BinaryTapePlayer &tape_player);
+};
+
+}
+}
+}
+
+#endif /* Storage_Tape_Parsers_AmstradCPC_hpp */
@@ -23,6 +23,8 @@ void PulseQueuedTape::set_is_at_end(bool is_at_end) {
 void PulseQueuedTape::clear() {
 	queued_pulses_.clear();
 	pulse_pointer_ = 0;
+	batch_state_.reset();
+	batch_is_resumable_ = true;
 }
 
 bool PulseQueuedTape::empty() {
@@ -52,6 +54,8 @@ Tape::Pulse PulseQueuedTape::virtual_get_next_pulse() {
 
 	if(pulse_pointer_ == queued_pulses_.size()) {
 		clear();
+		batch_state_ = get_batch_resume_state();
+		batch_is_resumable_ = !!batch_state_;
 		get_next_pulses();
 
 		if(is_at_end_ || pulse_pointer_ == queued_pulses_.size()) {
@@ -63,3 +67,29 @@ Tape::Pulse PulseQueuedTape::virtual_get_next_pulse() {
 	pulse_pointer_++;
 	return queued_pulses_[read_pointer];
 }
+
+std::unique_ptr<Tape::ResumeState> PulseQueuedTape::get_resume_state() {
+	if(!batch_is_resumable_) return nullptr;
+
+	QueueResumeState *const state = new QueueResumeState;
+	state->batch_state = batch_state_;
+	state->pulse_pointer = pulse_pointer_;
+	state->is_at_end = is_at_end_;
+	return std::unique_ptr<ResumeState>(state);
+}
+
+void PulseQueuedTape::set_resume_state(const ResumeState &state) {
+	const QueueResumeState &queue_state = static_cast<const QueueResumeState &>(state);
+
+	// If the batch in progress wasn't that posted upon reset, produce it again.
+	if(queue_state.batch_state) {
+		clear();
+		set_batch_resume_state(*queue_state.batch_state);
+		batch_state_ = queue_state.batch_state;
+		batch_is_resumable_ = true;
+		get_next_pulses();
+	}
+
+	pulse_pointer_ = queue_state.pulse_pointer;
+	is_at_end_ = queue_state.is_at_end;
+}
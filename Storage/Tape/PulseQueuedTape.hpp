@@ -24,6 +24,11 @@ namespace Tape {
 	Otherwise get_next_pulse() returns something from the pulse queue if there is
 	anything there, and otherwise calls get_next_pulses(). get_next_pulses() is
 	virtual, giving subclasses a chance to provide the next batch of pulses.
+
+	Subclasses that implement @c get_batch_resume_state and @c set_batch_resume_state
+	support checkpoints at any point: a checkpoint records the state from which the current
+	batch was produced plus the position within it, and is restored by producing that batch again.
+	The batch posted by @c reset is assumed to be the one that begins after any call to @c clear().
 */
 class PulseQueuedTape: public Tape {
 	public:
@@ -39,13 +44,37 @@ class PulseQueuedTape: public Tape {
 		void set_is_at_end(bool);
 		virtual void get_next_pulses() = 0;
 
+		/*!
+			@returns state from which the next call to @c get_next_pulses could be repeated, or
+			@c nullptr if no such state can be provided.
+		*/
+		virtual std::unique_ptr<ResumeState> get_batch_resume_state() { return nullptr; }
+
+		/// Restores @c state, as previously returned by @c get_batch_resume_state.
+		virtual void set_batch_resume_state(const ResumeState &state) {}
+
 	private:
 		Pulse virtual_get_next_pulse();
 		Pulse silence();
 
+		std::unique_ptr<ResumeState> get_resume_state();
+		void set_resume_state(const ResumeState &state);
+
 		std::vector<Pulse> queued_pulses_;
 		std::size_t pulse_pointer_;
 		bool is_at_end_;
+
+		// The state from which the current batch was produced; if it is nullptr then
+		// the batch is the one produced by reset if batch_is_resumable_ is set, and
+		// cannot be reproduced otherwise.
+		std::shared_ptr<ResumeState> batch_state_;
+		bool batch_is_resumable_ = true;
+
+		struct QueueResumeState: public ResumeState {
+			std::shared_ptr<ResumeState> batch_state;
+			std::size_t pulse_pointer;
+			bool is_at_end;
+		};
 };
 
 }
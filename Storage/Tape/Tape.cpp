@@ -9,6 +9,8 @@
 #include "Tape.hpp"
 #include "../../NumberTheory/Factors.hpp"
 
+#include <algorithm>
+
 using namespace Storage::Tape;
 
 // MARK: - Lifecycle
@@ -20,34 +22,76 @@ TapePlayer::TapePlayer(unsigned int input_clock_rate) :
 // MARK: - Seeking
 
 void Storage::Tape::Tape::seek(Time &seek_time) {
-	Time next_time(0);
-	reset();
-	while(next_time <= seek_time) {
+	// Find the latest checkpoint at or before the target time, and resume from there unless the
+	// tape is already further along.
+	const auto checkpoint = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), seek_time, [] (const Time &time, const Checkpoint &checkpoint) {
+		return time < checkpoint.time;
+	});
+	const Checkpoint *const start = (checkpoint == checkpoints_.begin()) ? nullptr : &*(checkpoint - 1);
+	if(seek_time < current_time_ || (start && current_time_ < start->time)) {
+		restore_checkpoint(start);
+	}
+
+	while(current_time_ <= seek_time) {
 		get_next_pulse();
-		next_time += pulse_.length;
 	}
 }
 
 Storage::Time Tape::get_current_time() {
-	Time time(0);
-	uint64_t steps = get_offset();
-	reset();
-	while(steps--) {
-		get_next_pulse();
-		time += pulse_.length;
-	}
-	return time;
+	return current_time_;
 }
 
 void Storage::Tape::Tape::reset() {
 	offset_ = 0;
+	current_time_ = Time(0);
 	virtual_reset();
 }
 
 Tape::Pulse Tape::get_next_pulse() {
-	pulse_ = virtual_get_next_pulse();
+	const Pulse pulse = virtual_get_next_pulse();
 	offset_++;
-	return pulse_;
+	current_time_ += pulse.length;
+
+	// Extend the index if this is the furthest that the tape has yet been played, and
+	// sufficiently far beyond the last checkpoint.
+	if(offset_ == next_checkpoint_offset_) {
+		next_checkpoint_offset_ += checkpoint_interval_;
+
+		std::unique_ptr<ResumeState> state = get_resume_state();
+		if(state) {
+			checkpoints_.emplace_back();
+			checkpoints_.back().offset = offset_;
+			checkpoints_.back().time = current_time_;
+			checkpoints_.back().state = std::move(state);
+
+			// If the index is full, keep only every other checkpoint and space future ones to match.
+			if(checkpoints_.size() >= maximum_checkpoints_) {
+				std::size_t kept = 1;
+				for(std::size_t index = 2; index < checkpoints_.size(); index += 2) {
+					checkpoints_[kept] = std::move(checkpoints_[index]);
+					++kept;
+				}
+				checkpoints_.erase(checkpoints_.begin() + static_cast<long>(kept), checkpoints_.end());
+				checkpoint_interval_ <<= 1;
+				next_checkpoint_offset_ = offset_ + checkpoint_interval_;
+			}
+		}
+	}
+
+	return pulse;
+}
+
+void Tape::restore_checkpoint(const Checkpoint *checkpoint) {
+	reset();
+	if(checkpoint) {
+		set_resume_state(*checkpoint->state);
+		offset_ = checkpoint->offset;
+		current_time_ = checkpoint->time;
+	}
+}
+
+void Tape::set_maximum_checkpoints(std::size_t maximum_checkpoints) {
+	maximum_checkpoints_ = std::max(maximum_checkpoints, std::size_t(2));
 }
 
 uint64_t Tape::get_offset() {
@@ -56,9 +100,17 @@ uint64_t Tape::get_offset() {
 
 void Tape::set_offset(uint64_t offset) {
 	if(offset == offset_) return;
-	if(offset < offset_) {
-		reset();
+
+	// Find the latest checkpoint at or before the target offset, and resume from there if
+	// going backwards or if it's further along than the tape currently is.
+	const auto checkpoint = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), offset, [] (uint64_t offset, const Checkpoint &checkpoint) {
+		return offset < checkpoint.offset;
+	});
+	const Checkpoint *const start = (checkpoint == checkpoints_.begin()) ? nullptr : &*(checkpoint - 1);
+	if(offset < offset_ || (start && start->offset > offset_)) {
+		restore_checkpoint(start);
 	}
+
 	offset -= offset_;
 	while(offset--) get_next_pulse();
 }
@@ -113,6 +165,19 @@ void TapePlayer::process_next_event() {
 	get_next_pulse();
 }
 
+void TapePlayer::serialise(State::Archive &archive) {
+	archive.tag("TapePlayer");
+	TimedEventLoop::serialise(archive);
+	archive(current_pulse_);
+
+	uint64_t offset = tape_ ? tape_->get_offset() : 0;
+	archive(offset);
+	if(!archive.is_saving() && archive.is_valid()) {
+		if(tape_) tape_->set_offset(offset);
+		update_sleep_observer();
+	}
+}
+
 // MARK: - Binary Player
 
 BinaryTapePlayer::BinaryTapePlayer(unsigned int input_clock_rate) :
@@ -146,6 +211,12 @@ void BinaryTapePlayer::run_for(const Cycles cycles) {
 	if(motor_is_running_) TapePlayer::run_for(cycles);
 }
 
+void BinaryTapePlayer::serialise(State::Archive &archive) {
+	TapePlayer::serialise(archive);
+	archive(input_level_, motor_is_running_);
+	if(!archive.is_saving()) update_sleep_observer();
+}
+
 void BinaryTapePlayer::set_delegate(Delegate *delegate) {
 	delegate_ = delegate;
 }
@@ -10,6 +10,7 @@
 #define Tape_hpp
 
 #include <memory>
+#include <vector>
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
 #include "../../ClockReceiver/Sleeper.hpp"
@@ -29,6 +30,12 @@ namespace Tape {
 	Subclasses should implement at least @c get_next_pulse and @c reset to provide a serial feeding
 	of pulses and the ability to return to the start of the feed. They may also implement @c seek if
 	a better implementation than a linear search from the @c reset time can be implemented.
+
+	Subclasses that can also capture and restore the state from which they produce pulses should
+	implement @c get_resume_state and @c set_resume_state; the tape will then build an index of
+	checkpoints as pulses are produced, so that @c seek and @c set_offset need replay only
+	from the nearest checkpoint rather than from the start of the tape. The cost of restoring a
+	checkpoint is format-specific; it is not necessarily constant.
 */
 class Tape {
 	public:
@@ -69,23 +76,66 @@ class Tape {
 		virtual void set_offset(uint64_t);
 
 		/*!
-			Calculates and returns the amount of time that has elapsed since the time began. Potentially expensive.
+			@returns the amount of time that has elapsed since the tape began.
 		*/
 		virtual Time get_current_time();
 
 		/*!
-			Seeks to @c time. Potentially expensive.
+			Seeks to @c time. Potentially expensive if this tape doesn't support checkpoints.
 		*/
 		virtual void seek(Time &time);
 
 		virtual ~Tape() {};
 
+	protected:
+		/*!
+			Format-specific state sufficient to resume production of pulses from a particular point;
+			subclasses that support checkpoints should derive their own.
+		*/
+		struct ResumeState {
+			virtual ~ResumeState() {}
+		};
+
+		/*!
+			Limits the checkpoint index to @c maximum_checkpoints entries; whenever that limit is reached, every
+			other checkpoint is discarded and those that follow are spaced twice as far apart. Subclasses with
+			large resume states should set a limit appropriate to them.
+		*/
+		void set_maximum_checkpoints(std::size_t maximum_checkpoints);
+
 	private:
-		uint64_t offset_;
-		Tape::Pulse pulse_;
+		uint64_t offset_ = 0;
+		Time current_time_;
 
 		virtual Pulse virtual_get_next_pulse() = 0;
 		virtual void virtual_reset() = 0;
+
+		/*!
+			@returns state from which pulses following the most recent could be reproduced after a call
+			to @c reset, or @c nullptr if no such state can currently be provided.
+		*/
+		virtual std::unique_ptr<ResumeState> get_resume_state() { return nullptr; }
+
+		/*!
+			Restores @c state, as previously returned by @c get_resume_state. This will be called only
+			immediately after @c reset.
+		*/
+		virtual void set_resume_state(const ResumeState &state) {}
+
+		// The checkpoint index; checkpoints are attempted once every checkpoint_interval_ pulses
+		// that extend beyond the end of the index, and are stored in ascending order.
+		static constexpr uint64_t CheckpointInterval = 4096;
+		struct Checkpoint {
+			uint64_t offset;
+			Time time;
+			std::unique_ptr<ResumeState> state;
+		};
+		std::vector<Checkpoint> checkpoints_;
+		uint64_t checkpoint_interval_ = CheckpointInterval;
+		uint64_t next_checkpoint_offset_ = CheckpointInterval;
+		std::size_t maximum_checkpoints_ = 4096;
+
+		void restore_checkpoint(const Checkpoint *checkpoint);
 };
 
 /*!
@@ -109,6 +159,12 @@ class TapePlayer: public TimedEventLoop, public Sleeper {
 
 		bool is_sleeping();
 
+		/*!
+			Records or restores the player's position within the current tape, which upon restoration
+			must be the same tape as when state was recorded.
+		*/
+		void serialise(State::Archive &archive);
+
 	protected:
 		virtual void process_next_event();
 		virtual void process_input_pulse(const Tape::Pulse &pulse) = 0;
@@ -147,6 +203,9 @@ class BinaryTapePlayer: public TapePlayer {
 
 		bool is_sleeping();
 
+		/// Records or restores the tape position, as per TapePlayer, plus the motor state and current input level.
+		void serialise(State::Archive &archive);
+
 	protected:
 		Delegate *delegate_ = nullptr;
 		virtual void process_input_pulse(const Storage::Tape::Tape::Pulse &pulse);
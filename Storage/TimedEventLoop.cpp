@@ -83,3 +83,7 @@ Time TimedEventLoop::get_time_into_next_event() {
 	Time zero;
 	return zero;
 }
+
+void TimedEventLoop::serialise(State::Archive &archive) {
+	archive(cycles_until_event_, subcycles_until_event_);
+}
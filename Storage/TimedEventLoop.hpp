@@ -12,6 +12,7 @@
 #include "Storage.hpp"
 #include "../ClockReceiver/ClockReceiver.hpp"
 #include "../SignalProcessing/Stepper.hpp"
+#include "../State/Archive.hpp"
 
 #include <memory>
 
@@ -99,6 +100,9 @@ namespace Storage {
 			*/
 			Time get_time_into_next_event();
 
+			/// Records or restores the time until the next event.
+			void serialise(State::Archive &archive);
+
 		private:
 			unsigned int input_clock_rate_ = 0;
 			int cycles_until_event_ = 0;